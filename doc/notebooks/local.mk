@@ -100,6 +100,7 @@ dist_notebooks_DATA =                           \
   %D%/automaton.realtime.ipynb                  \
   %D%/automaton.reduce.ipynb                    \
   %D%/automaton.rweight.ipynb                   \
+  %D%/automaton.sample.ipynb                    \
   %D%/automaton.scc.ipynb                       \
   %D%/automaton.shortest.ipynb                  \
   %D%/automaton.shuffle.ipynb                   \
@@ -4,6 +4,7 @@
 #include <lib/vcsn/dyn/context-parser.hh>
 #include <lib/vcsn/dyn/signature-printer.hh>
 
+#include <vcsn/alphabets/char.hh>
 #include <vcsn/misc/escape.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/misc/set.hh>
@@ -174,7 +175,8 @@ namespace vcsn
       /// \param letter_type should be `char_letter`, or `char`, etc.
       std::shared_ptr<const genset> genset_(std::string letter_type)
       {
-        if (letter_type == "char" || letter_type == "string")
+        if (letter_type == "char" || letter_type == "string"
+            || letter_type == "string_id")
           letter_type += "_letters";
         std::string gens;
         if (peek_() == '(')
@@ -193,9 +195,33 @@ namespace vcsn
               }
             gens += ')';
           }
+        if (letter_type == "char_range")
+          gens = char_range_(gens);
         return std::make_shared<const genset>(letter_type, gens);
       }
 
+      /// Normalize the range of a char_range (e.g., `(\x61-z)` =>
+      /// `(a-z)`), since it is part of its type name.
+      std::string char_range_(const std::string& gens)
+      {
+        auto is = std::istringstream{gens};
+        auto ls = char_letters{};
+        eat(is, '(');
+        auto first = ls.get_letter(is);
+        eat(is, '-');
+        auto last = ls.get_letter(is);
+        eat(is, ')');
+        require(is.peek() == EOF,
+                "char_range: invalid range: ", gens);
+        auto o = std::ostringstream{};
+        o << '(';
+        ls.print(first, o, format::sname);
+        o << '-';
+        ls.print(last, o, format::sname);
+        o << ')';
+        return o.str();
+      }
+
       /// `<LabelSet>, <WeightSet>`.
       std::shared_ptr<context> context_()
       {
@@ -231,6 +257,10 @@ namespace vcsn
       {
         if (ls == "lal_char")
           return std::make_shared<letterset>(genset_("char_letters"));
+        else if (ls == "lal_char_ascii")
+          // lal_char_ascii => letterset<char_range(\x01-\x7f)>.
+          return std::make_shared<letterset>
+            (std::make_shared<const genset>("char_range", "(\\x01-\\x7f)"));
         else if (ls == "lan")
           // lan<GENSET> => nullableset<letterset<GENSET>>.
           return std::make_shared<nullableset>(std::make_shared<letterset>
@@ -348,7 +378,8 @@ namespace vcsn
             eat_('>');
           }
         // xxx_automaton<Aut...>.
-        else if (prefix == "compose_automaton"
+        else if (prefix == "completed_product_automaton"
+                 || prefix == "compose_automaton"
                  || prefix == "product_automaton"
                  || prefix == "tuple_automaton")
           {
@@ -486,10 +517,12 @@ namespace vcsn
           "log",
           "nmin",
           "q",
+          "qh",
           "qmp",
           "r",
           "rmin",
           "z",
+          "zh",
           "zmin",
         };
 
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <lib/vcsn/dyn/type-ast.hh>
+#include <vcsn/alphabets/char.hh>
 #include <vcsn/misc/getargs.hh>
 #include <vcsn/misc/indent.hh>
 
@@ -54,6 +55,7 @@ namespace vcsn
         {
           "automaton type",
           {
+            {"completed_product_automaton", "vcsn/algos/conjunction.hh"},
             {"compose_automaton"      , "vcsn/algos/compose.hh"},
             {"delay_automaton"        , "vcsn/algos/is-synchronized.hh"},
             {"derived_term_automaton" , "vcsn/algos/derived-term.hh"},
@@ -146,12 +148,31 @@ namespace vcsn
 
     DEFINE(genset)
     {
-      header("vcsn/alphabets/setalpha.hh"); // set_alphabet
-      if (t.letter_type() == "char_letters")
-        header("vcsn/alphabets/char.hh");
-      else if (t.letter_type() == "string_letters")
-        header("vcsn/alphabets/string.hh");
-      os_ << "vcsn::set_alphabet<vcsn::" << t.letter_type() << '>';
+      if (t.letter_type() == "char_range")
+        {
+          // char_range(a-z) => range_alphabet<97, 122>.
+          header("vcsn/alphabets/rangealpha.hh");
+          auto is = std::istringstream{t.generators()};
+          eat(is, '(');
+          auto first = uint8_t(char_letters::get_letter(is));
+          eat(is, '-');
+          auto last = uint8_t(char_letters::get_letter(is));
+          eat(is, ')');
+          require(0 < first && first <= last && last < 255,
+                  "char_range: invalid range: ", t.generators());
+          os_ << "vcsn::range_alphabet<"
+              << int(first) << ", " << int(last) << '>';
+        }
+      else
+        {
+          header("vcsn/alphabets/setalpha.hh"); // set_alphabet
+          if (t.letter_type() == "char_letters")
+            header("vcsn/alphabets/char.hh");
+          else if (t.letter_type() == "string_letters"
+                   || t.letter_type() == "string_id_letters")
+            header("vcsn/alphabets/string.hh");
+          os_ << "vcsn::set_alphabet<vcsn::" << t.letter_type() << '>';
+        }
     }
 
     DEFINE(letterset)
@@ -181,7 +202,8 @@ namespace vcsn
     DEFINE(weightset)
     {
       header("vcsn/weightset/" + t.get_type() + ".hh");
-      if (t.get_type() == "qmp")
+      if (t.get_type() == "qh" || t.get_type() == "qmp"
+          || t.get_type() == "zh")
         linkflags("-lgmp -lgmpxx");
       os_ << "vcsn::" << t.get_type();
     }
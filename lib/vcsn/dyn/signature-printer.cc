@@ -86,7 +86,8 @@ namespace vcsn
     DEFINE(genset)
     {
       os_ << t.letter_type();
-      if (full_)
+      // The range of char_range is part of its type.
+      if (full_ || t.letter_type() == "char_range")
         os_ << t.generators();
     }
 
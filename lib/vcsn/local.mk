@@ -72,6 +72,7 @@ lib_libvcsn_la_SOURCES =                        \
   %D%/misc/random.cc                            \
   %D%/misc/signature.cc                         \
   %D%/misc/stream.cc                            \
+  %D%/misc/string-id.cc                         \
   %D%/misc/xltdl.cc                             \
   %D%/misc/xltdl.hh
 
@@ -0,0 +1,66 @@
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/string-id.hh>
+
+namespace vcsn
+{
+  namespace
+  {
+    /// The table of the strings, and their ids.
+    struct string_table
+    {
+      string_table()
+      {
+        // The empty string is 0, the id of default-constructed
+        // string_ids.
+        strings.emplace_back();
+        ids.emplace(strings.back(), 0);
+      }
+
+      std::mutex mutex;
+      /// Id -> string.  Stable addresses.
+      std::deque<std::string> strings;
+      /// String -> id.
+      std::unordered_map<std::string, string_id::id_t> ids;
+    };
+
+    string_table& table()
+    {
+      static string_table res;
+      return res;
+    }
+  }
+
+  string_id::id_t string_id::intern_(const std::string& s)
+  {
+    auto& t = table();
+    std::lock_guard<std::mutex> lock{t.mutex};
+    auto i = t.ids.find(s);
+    if (i == end(t.ids))
+      {
+        require(t.strings.size() < std::numeric_limits<id_t>::max(),
+                "string_id: too many strings");
+        auto res = id_t(t.strings.size());
+        t.strings.emplace_back(s);
+        i = t.ids.emplace(s, res).first;
+      }
+    return i->second;
+  }
+
+  const std::string& string_id::get_(id_t i)
+  {
+    auto& t = table();
+    std::lock_guard<std::mutex> lock{t.mutex};
+    return t.strings[i];
+  }
+
+  std::ostream& operator<<(std::ostream& o, string_id s)
+  {
+    return o << s.get();
+  }
+}
@@ -1,3 +1,4 @@
+#include <functional>
 #include <sstream>
 
 #include <boost/algorithm/string/predicate.hpp> // boost::algorithm::contains
@@ -40,6 +41,8 @@ namespace vcsn
           tape_ctx_.emplace_back(dyn::project(ctx_, t));
       else
         tape_ctx_.emplace_back(ctx_);
+      atoms_.clear();
+      atoms_.resize(tape_ctx_.size() + 1);
     }
 
     void driver::context(const std::string& ctx)
@@ -149,12 +152,47 @@ namespace vcsn
       // FIXME: Remove once the tuple approach works perfectly.  And
       // simplify make_label accordingly (no dyn::context argument
       // needed).
-      if (boost::algorithm::contains(s, ","))
-        return dyn::to_expression(ctx_, ids_,
-                                  make_label(loc, s, ctx_));
+      auto multitape = boost::algorithm::contains(s, ",");
+      auto& atoms = atoms_[multitape ? tape_ctx_.size() : tapes_.back()];
+      auto i = atoms.find(s);
+      if (i == end(atoms))
+        {
+          const auto& ctx = multitape ? ctx_ : context();
+          auto res = dyn::to_expression(ctx, ids_, make_label(loc, s, ctx));
+          i = atoms.emplace(s, res).first;
+        }
+      return i->second;
+    }
+
+    dyn::expression
+    driver::make_sum(const std::vector<dyn::expression>& es)
+    {
+      assert(!es.empty());
+      if (ids_.is_associative())
+        {
+          // The sum of es[b, e).
+          std::function<dyn::expression(size_t, size_t)> sum
+            = [&es, &sum](size_t b, size_t e)
+            {
+              if (e - b == 1)
+                return es[b];
+              else
+                {
+                  auto m = b + (e - b) / 2;
+                  return dyn::add(sum(b, m), sum(m, e));
+                }
+            };
+          return sum(0, es.size());
+        }
       else
-        return dyn::to_expression(context(), ids_,
-                                  make_label(loc, s, context()));
+        {
+          // Without associativity, the tree matters: keep the
+          // addition left-associative.
+          auto res = es[0];
+          for (size_t i = 1; i < es.size(); ++i)
+            res = dyn::add(res, es[i]);
+          return res;
+        }
     }
 
     dyn::expression
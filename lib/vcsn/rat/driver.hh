@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <lib/vcsn/rat/fwd.hh>
 #include <lib/vcsn/rat/parse.hh>
 #include <vcsn/core/rat/fwd.hh>
@@ -61,8 +65,18 @@ namespace vcsn
                             const dyn::context& ctx);
 
       /// From a string, generate an expression.
+      ///
+      /// Cached: large expressions often feature many occurrences of
+      /// the same few letters.
       dyn::expression make_atom(const location& loc, const std::string& s);
 
+      /// The sum of the (non empty) list of expressions \a es.
+      ///
+      /// With associative identities, the sum is built as a balanced
+      /// tree, which is linear (or n log n in linear identities),
+      /// instead of quadratic.
+      dyn::expression make_sum(const std::vector<dyn::expression>& es);
+
       /// From a label class, generate an expression.
       dyn::expression make_expression(const location& loc,
                                       const class_t& c, bool accept);
@@ -94,6 +108,9 @@ namespace vcsn
       std::vector<unsigned> tapes_ = {0};
       /// The context for each tape.  If single-tape, [0] is ctx_.
       std::vector<dyn::context> tape_ctx_ = {};
+      /// For each tape, the atoms already built, indexed by their
+      /// string.  The last one is for multitape labels.
+      std::vector<std::unordered_map<std::string, dyn::expression>> atoms_;
     };
   }
 }
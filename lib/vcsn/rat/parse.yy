@@ -179,8 +179,8 @@
 %token <std::string> WEIGHT "weight";
 %token <symbol>      LPAREN "(";
 
-%type <braced_expression> exp input add tuple;
-%type <std::vector<vcsn::dyn::expression>> tuple.1;
+%type <braced_expression> exp input tuple;
+%type <std::vector<vcsn::dyn::expression>> add tuple.1;
 %type <dyn::weight> weights;
 %type <class_t> class;
 
@@ -209,11 +209,12 @@ input:
     // Adjust with possible needed conversions e.g., `a*` -> `(a|a)*`.
     // Avoid it if possible, it is really expensive (see `vcsn score
     // -O 'b.expression'`).
-    TRY(@$, $$ = copy($1.exp, driver_.ctx_, driver_.ids_));
+    auto e = driver_.make_sum($1);
+    TRY(@$, $$ = copy(e, driver_.ctx_, driver_.ids_));
     if (0 < driver_.debug_level())
       std::cerr
         << "converted the expression\n"
-      << "  from: " << $1.exp << " (" << context_of($1.exp) << ")\n"
+      << "  from: " << e << " (" << context_of(e) << ")\n"
       << "    to: " << $$.exp << " (" << context_of($$.exp) << ")\n";
     driver_.result_ = $$.exp;
     YYACCEPT;
@@ -227,10 +228,23 @@ terminator.opt:
 | "]"        { driver_.scanner_->putback(']'); }
 ;
 
+// The terms of a sum, which is built only once complete: repeated
+// binary additions are quadratic in the number of terms.
 add:
-  tuple           { $$ = $1; }
-| add "+" add     { $$ = dyn::add($1.exp, $3.exp); }
-| add "@" add     { $$ = dyn::compose($1.exp, $3.exp); }
+  tuple
+  {
+    $$.emplace_back($1.exp);
+  }
+| add "+" add
+  {
+    $$ = std::move($1);
+    $$.insert(end($$), begin($3), end($3));
+  }
+| add "@" add
+  {
+    $$.emplace_back(dyn::compose(driver_.make_sum($1),
+                                 driver_.make_sum($3)));
+  }
 ;
 
 // Deal with `|`: a* | (b+c) | \e.
@@ -303,7 +317,7 @@ exp:
 | "[" "^" class "]" { $$ = driver_.make_expression(@$, $3, false); }
 | "(" add ")"
   {
-    $$.exp = $2.exp;
+    $$.exp = driver_.make_sum($2);
     $$.lparen = $$.rparen = true;
     if (!$1.get().empty())
       $$ = dyn::name($$.exp, $1.get());
@@ -6,7 +6,7 @@
 #include <boost/range/algorithm/transform.hpp>
 
 #include <vcsn/dyn/algos.hh>
-#include <vcsn/misc/stream.hh> // get_file_contents().
+#include <vcsn/misc/stream.hh> // open_output_file().
 
 #include "vcsn-tools.hh"
 
@@ -22,14 +22,6 @@ namespace
 
   bool used_stdin = false;
 
-  std::string read_stdin()
-  {
-    used_stdin = true;
-    std::cin >> std::noskipws;
-    std::istreambuf_iterator<char> begin(std::cin), end;
-    return {begin, end};
-  }
-
   /// All the parameters of a command.
   struct options
   {
@@ -64,14 +56,12 @@ namespace
       switch (auto opt = getopt(argc, argv, optstring))
         {
         case 'f':
-          {
-            auto in = std::string{optarg} == "-"
-              ? read_stdin()
-              : get_file_contents(optarg);
-            res.args.emplace_back(in, t, input_format);
-            t = type::unknown;
-            input_format = "default";
-          }
+          // Read only when needed, as a stream if possible.
+          if (std::string{optarg} == "-")
+            used_stdin = true;
+          res.args.emplace_back("", t, input_format, optarg);
+          t = type::unknown;
+          input_format = "default";
           break;
 
         case 'O':
@@ -97,7 +87,8 @@ namespace
             return res;
           else if (std::string{argv[optind]} == "-")
             {
-              res.args.emplace_back(read_stdin(), t, input_format);
+              used_stdin = true;
+              res.args.emplace_back("", t, input_format, "-");
               t = type::unknown;
               input_format = "default";
             }
@@ -150,28 +141,39 @@ namespace
         }
   }
 
-  bool is_match(const algo& a, const std::vector<parsed_arg>& args)
+  /// Whether \a args matches the signature of \a a.
+  ///
+  /// \param strict  whether untyped arguments do not match string
+  ///    parameters.
+  bool is_match(const algo& a, const std::vector<parsed_arg>& args,
+                bool strict)
   {
     if (a.signature.size() != args.size())
       return false;
 
     for (size_t i = 0; i < args.size(); i++)
       {
-        if (args[i].t != a.signature[i] && args[i].t != type::unknown)
+        if (args[i].t == type::unknown)
+          {
+            if (strict && a.signature[i] == type::string)
+              return false;
+          }
+        else if (args[i].t != a.signature[i])
           return false;
       }
     return true;
   }
 
   const algo* match(const std::string& algo_name,
-                    std::vector<parsed_arg>& args)
+                    std::vector<parsed_arg>& args,
+                    bool strict)
   {
     const algo* a = nullptr;
     auto range = vcsn::tools::algos.equal_range(algo_name);
     for (auto it = range.first; it != range.second; it++)
       {
         const auto& candidate = it->second;
-        if (!is_match(candidate, args))
+        if (!is_match(candidate, args, strict))
           continue;
         else if (a)
           {
@@ -179,7 +181,7 @@ namespace
             ss << "more than one algorithm found.\n"
                << "candidates are:\n";
             for (auto it = range.first; it != range.second; it++)
-              if(is_match(it->second, args))
+              if(is_match(it->second, args, strict))
                 ss << "  "<< it->second.declaration << '\n';
             ss << "Try 'vcsn " << algo_name << " --help' for more information.";
             raise(ss.str());
@@ -190,6 +192,20 @@ namespace
     return a;
   }
 
+  /// The algorithm called \a algo_name that matches \a args.
+  ///
+  /// Untyped arguments are first matched against the non-string
+  /// parameters: `vcsn trie -e 'a+b'` is about a polynomial, not a
+  /// stream (`vcsn trie -Se 'a+b'`).
+  const algo* match(const std::string& algo_name,
+                    std::vector<parsed_arg>& args)
+  {
+    if (auto res = match(algo_name, args, true))
+      return res;
+    else
+      return match(algo_name, args, false);
+  }
+
   /// Try to match for an algorithm.
   void match_and_call(const std::string& algo_name,
                       std::vector<parsed_arg>& args,
@@ -203,7 +219,7 @@ namespace
         a = match(algo_name, args);
         if (a)
           // We found an algo, read stdin.
-          args[0].arg = read_stdin();
+          args[0].filename = "-";
       }
     if (a)
       a->exec(args, context);
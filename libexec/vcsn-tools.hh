@@ -1,7 +1,10 @@
 #pragma once
 
 #include <functional>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -11,6 +14,7 @@
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/context.hh>
 #include <vcsn/dyn/value.hh>
+#include <vcsn/misc/stream.hh> // open_input_file
 
 namespace vcsn
 {
@@ -39,18 +43,37 @@ namespace vcsn
     /// A parsed argument: its value, its type, and its input format.
     struct parsed_arg
     {
-      parsed_arg(std::string arg_, type t_, std::string input_format_)
+      parsed_arg(std::string arg_, type t_, std::string input_format_,
+                 std::string filename_ = "")
         : arg{std::move(arg_)}
         , t{t_}
         , input_format{std::move(input_format_)}
+        , filename{std::move(filename_)}
       {}
       parsed_arg() = default;
 
-      std::string arg;
+      /// The value of the argument, read from its file the first
+      /// time it is needed.
+      const std::string& value() const
+      {
+        if (!filename.empty())
+          {
+            auto is = open_input_file(filename);
+            arg.assign(std::istreambuf_iterator<char>(*is),
+                       std::istreambuf_iterator<char>());
+            filename.clear();
+          }
+        return arg;
+      }
+
+      mutable std::string arg;
       type t;
       // Can't use a default initializer here as GCC 4.9 doesn't
       // support them in aggregate types.
       std::string input_format;
+      /// If not empty, the value is the contents of this file ("-"
+      /// for stdin), not read yet.
+      mutable std::string filename;
     };
 
     /// A function from dyn algo: its "signature" (its formal
@@ -206,7 +229,17 @@ namespace vcsn
     T
     convert(const parsed_arg& arg, const dyn::context& ctx)
     {
-      return vcsn::tools::convert<T>(arg.arg, ctx, arg.input_format);
+      return vcsn::tools::convert<T>(arg.value(), ctx, arg.input_format);
+    }
+
+    /// A stream on an argument.  Files are not loaded in memory.
+    inline std::shared_ptr<std::istream>
+    convert_istream(const parsed_arg& arg)
+    {
+      if (arg.filename.empty())
+        return std::make_shared<std::istringstream>(arg.arg);
+      else
+        return open_input_file(arg.filename);
     }
   }
 
@@ -214,6 +214,45 @@ class automaton:
             algo = 'lazy,' + algo
         return self._determinize_orig(algo)
 
+    @staticmethod
+    def from_arrays(ctx, sources, destinations, labels, weights=None,
+                    label_names=None, states=None):
+        '''Build an automaton of context `ctx` from flat arrays, one
+        entry per transition: the reverse of `to_arrays`.
+
+        The arrays may be lists, `array.array`s, NumPy arrays (int32 for
+        states and labels, float64 for weights) or any object that
+        supports the buffer protocol.  Sources (resp. destinations) of
+        -1 denote initial (resp. final) weights.  If `label_names` is
+        None, `labels` are label strings (None for initial and final
+        weights), otherwise indexes in `label_names`.'''
+        import array
+
+        def buf(a, code):
+            if a is None:
+                return None
+            try:
+                m = memoryview(a)
+                if m.format.lstrip('@=') == code and m.c_contiguous:
+                    return a
+            except TypeError:
+                pass
+            return array.array(code, a)
+
+        if label_names is None:
+            label_names = sorted({l for l in labels if l is not None})
+            ids = {l: i for i, l in enumerate(label_names)}
+            labels = [-1 if l is None else ids[l] for l in labels]
+        if isinstance(ctx, str):
+            from vcsn_cxx import context
+            ctx = context(ctx)
+        return ctx._from_arrays(buf(states, 'i'),
+                                buf(sources, 'i'),
+                                buf(destinations, 'i'),
+                                buf(labels, 'i'),
+                                buf(weights, 'd'),
+                                [str(l) for l in label_names])
+
     def _display(self, mode, engine="dot"):
         '''Display automaton `self` in `mode` with Graphviz `engine`.'''
         from IPython.display import display
@@ -255,12 +294,23 @@ class automaton:
         return _dot_pretty(self.format('dot,utf8'), mode)
 
     # automaton.evaluate.
-    def evaluate(self, w):
+    def evaluate(self, w=None, algo='auto', format='default', filename=''):
         '''Evaluation of word (or polynomial) `w` on `self`, with possible
         conversion from plain string to genuine label object.
+
+        Polynomials are evaluated with `algo`: "monomials" (one after
+        the other), "trie" (sharing the evaluation of common prefixes),
+        or "auto".
+
+        If `filename` is given, evaluate the words it contains, one per
+        line, in `format` ("words" or "monomials"), without loading them.
         '''
+        if filename:
+            return self._evaluate('', format, filename)
         c = self.context()
-        if not isinstance(w, label) and not isinstance(w, polynomial):
+        if isinstance(w, polynomial):
+            return self._evaluate(w, algo)
+        if not isinstance(w, label):
             w = c.word(str(w))
         return self._evaluate(w)
     __call__ = evaluate
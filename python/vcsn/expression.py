@@ -2,7 +2,7 @@
 ## expression.  ##
 ## ------------ ##
 
-from vcsn_cxx import label, expression
+from vcsn_cxx import label, expression, expression_matcher
 from vcsn.dot import _dot_pretty, _dot_to_svg
 from vcsn.tools import (_extend, _format, _info_to_dict,
                         _lweight, _rweight)
@@ -160,3 +160,31 @@ class expression:
     shortest = lambda self, *a, **kw: self.automaton().shortest(*a, **kw)
     star = lambda self: self.multiply(-1)
     type = lambda self: self.info('type')
+
+
+@_extend(expression_matcher)
+class expression_matcher:
+    def _word(self, w):
+        if not isinstance(w, label):
+            w = self.context().word(str(w))
+        return w
+
+    def match(self, w):
+        '''The weight of word `w`, or the list of weights of the list of
+        words `w`.
+        '''
+        if isinstance(w, list):
+            return self._match([self._word(i) for i in w])
+        else:
+            return self._match(self._word(w))
+    __call__ = match
+
+    def search(self, w):
+        '''The sum of the weights of the factors of `w` (e.g., for Boolean
+        expressions, whether some factor of `w` matches), or the list
+        of these sums for the list of words `w`.
+        '''
+        if isinstance(w, list):
+            return self._search([self._word(i) for i in w])
+        else:
+            return self._search(self._word(w))
@@ -35,6 +35,7 @@
 
 #include <vcsn/odyn/odyn.hh>
 #include <vcsn/dyn/algos.hh>
+#include <vcsn/misc/builtins.hh>
 
 using namespace vcsn::odyn;
 
@@ -49,7 +50,13 @@ using evaluate_t
   = auto (automaton::*)(const label&) const -> weight;
 
 using evaluate_polynomial_t
-  = auto (automaton::*)(const polynomial&) const -> weight;
+  = auto (automaton::*)(const polynomial&, const std::string&) const
+    -> weight;
+
+using evaluate_stream_t
+  = auto (automaton::*)(const std::string&, const std::string&,
+                        const std::string&) const
+    -> weight;
 
 /// The type of the binary multiply function for automata.
 using automaton_multiply_t
@@ -76,7 +83,7 @@ using multiply_repeated_t =
 using label_multiply_repeated_t =
   auto (label::*)(int exp) const -> label;
 
-/// The type of string-based trie/cotrie.
+/// The type of string-based trie/cotrie/dawg.
 using string_trie_t =
   auto (context::*)(const std::string&, const std::string&,
                     const std::string&) const
@@ -147,6 +154,15 @@ automaton automaton_lift(const automaton& aut,
   return aut.lift(make_vector<unsigned>(tapes), ids);
 }
 
+boost::python::list automaton_sample(const automaton& aut, unsigned num,
+                                     int length)
+{
+  auto res = boost::python::list{};
+  for (const auto& w: aut.sample(num, length))
+    res.append(w);
+  return res;
+}
+
 automaton automaton_shuffle(const boost::python::list& l)
 {
   return automaton::shuffle(make_vector<automaton>(l));
@@ -190,6 +206,198 @@ polynomial polynomial_tuple(const boost::python::list& l)
   return polynomial::tuple(make_vector<polynomial>(l));
 }
 
+/// Python's iterator protocol: the next path, or StopIteration.
+polynomial lightest_iterator_next(lightest_iterator& i)
+{
+  if (auto res = i.next())
+    return *res;
+  else
+    {
+      PyErr_SetNone(PyExc_StopIteration);
+      boost::python::throw_error_already_set();
+      BUILTIN_UNREACHABLE();
+    }
+}
+
+context matcher_context(const expression_matcher& m)
+{
+  return m.context();
+}
+
+weight matcher_match(expression_matcher& m, const label& w)
+{
+  return m.match(w.val_);
+}
+
+boost::python::list matcher_match_list(expression_matcher& m,
+                                       const boost::python::list& ws)
+{
+  auto res = boost::python::list{};
+  for (const auto& w: m.match(make_value_vector<label>(ws)))
+    res.append(weight(w));
+  return res;
+}
+
+weight matcher_search(expression_matcher& m, const label& w)
+{
+  return m.search(w.val_);
+}
+
+boost::python::list matcher_search_list(expression_matcher& m,
+                                        const boost::python::list& ws)
+{
+  auto res = boost::python::list{};
+  for (const auto& w: m.search(make_value_vector<label>(ws)))
+    res.append(weight(w));
+  return res;
+}
+
+polynomial path_index_query(lightest_path_index& i,
+                            unsigned src, unsigned dst,
+                            const std::string& algo)
+{
+  return i.query(src, dst, algo);
+}
+
+
+/*---------------------.
+| automaton_arrays.    |
+`---------------------*/
+
+/// A read-only array, shared with Python via the buffer protocol
+/// (e.g., `memoryview(a)` or `numpy.asarray(a)`), without copy.
+struct array_buffer
+{
+  template <typename T>
+  array_buffer(const std::shared_ptr<automaton_arrays>& owner,
+               const std::vector<T>& v, const char* format)
+    : owner{owner}
+    , data{v.data()}
+    , shape{Py_ssize_t(v.size())}
+    , itemsize{sizeof(T)}
+    , format{format}
+  {}
+
+  /// Keeps the data alive.
+  std::shared_ptr<automaton_arrays> owner;
+  const void* data;
+  Py_ssize_t shape;
+  Py_ssize_t itemsize;
+  /// Item type, as in the `struct` module.
+  const char* format;
+};
+
+/// The `bf_getbuffer` slot of array_buffer.
+int array_buffer_get(PyObject* obj, Py_buffer* view, int flags)
+{
+  auto& b = boost::python::extract<array_buffer&>(obj)();
+  if (flags & PyBUF_WRITABLE)
+    {
+      PyErr_SetString(PyExc_BufferError, "array is read-only");
+      view->obj = nullptr;
+      return -1;
+    }
+  view->obj = obj;
+  Py_INCREF(obj);
+  view->buf = const_cast<void*>(b.data);
+  view->len = b.shape * b.itemsize;
+  view->readonly = 1;
+  view->itemsize = b.itemsize;
+  view->format = flags & PyBUF_FORMAT ? const_cast<char*>(b.format) : nullptr;
+  view->ndim = 1;
+  view->shape = flags & PyBUF_ND ? &b.shape : nullptr;
+  view->strides = flags & PyBUF_STRIDES ? &b.itemsize : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+PyBufferProcs array_buffer_procs = {&array_buffer_get, nullptr};
+
+Py_ssize_t array_buffer_len(const array_buffer& b)
+{
+  return b.shape;
+}
+
+/// The arrays of \a aut, kept in a shared_ptr, as the buffers refer
+/// to them.
+std::shared_ptr<automaton_arrays> automaton_to_arrays(const automaton& aut)
+{
+  return std::make_shared<automaton_arrays>(aut.to_arrays());
+}
+
+/// Define an array_buffer accessor to a member of automaton_arrays.
+#define DEFINE(Member, Format)                                          \
+  array_buffer arrays_ ## Member                                       \
+    (const std::shared_ptr<automaton_arrays>& a)                 \
+  {                                                                    \
+    return {a, a->Member, Format};                                     \
+  }
+
+DEFINE(states, "i");
+DEFINE(sources, "i");
+DEFINE(destinations, "i");
+DEFINE(labels, "i");
+DEFINE(weights, "d");
+#undef DEFINE
+
+boost::python::list arrays_label_names(const automaton_arrays& a)
+{
+  auto res = boost::python::list{};
+  for (const auto& l: a.label_names)
+    res.append(l);
+  return res;
+}
+
+/// Copy an object that supports the buffer protocol, whose items are
+/// of type \a T, described by \a format (as in the `struct` module).
+/// None is an empty vector.
+template <typename T>
+std::vector<T> buffer_to_vector(const boost::python::object& o,
+                                const std::string& format)
+{
+  auto res = std::vector<T>{};
+  if (!o.is_none())
+    {
+      auto view = Py_buffer{};
+      if (PyObject_GetBuffer(o.ptr(), &view,
+                             PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == -1)
+        boost::python::throw_error_already_set();
+      auto f = std::string{view.format ? view.format : "B"};
+      // Native byte order is fine.
+      if (!f.empty() && (f[0] == '@' || f[0] == '='))
+        f.erase(0, 1);
+      auto ok = f == format && view.itemsize == sizeof(T);
+      if (ok)
+        {
+          const auto* data = static_cast<const T*>(view.buf);
+          res.assign(data, data + view.len / sizeof(T));
+        }
+      PyBuffer_Release(&view);
+      VCSN_REQUIRE(ok, "from_arrays: invalid item type: ", f,
+                   ", expected ", format);
+    }
+  return res;
+}
+
+automaton context_from_arrays(const context& ctx,
+                              const boost::python::object& states,
+                              const boost::python::object& sources,
+                              const boost::python::object& destinations,
+                              const boost::python::object& labels,
+                              const boost::python::object& weights,
+                              const boost::python::list& label_names)
+{
+  auto a = automaton_arrays{};
+  a.states = buffer_to_vector<int32_t>(states, "i");
+  a.sources = buffer_to_vector<int32_t>(sources, "i");
+  a.destinations = buffer_to_vector<int32_t>(destinations, "i");
+  a.labels = buffer_to_vector<int32_t>(labels, "i");
+  a.weights = buffer_to_vector<double>(weights, "d");
+  a.label_names = make_vector<std::string>(label_names);
+  return ctx.from_arrays(a);
+}
+
 
 /// See http://stackoverflow.com/a/6794523/1353549.
 ///
@@ -360,10 +568,13 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("costandard", &automaton::costandard)
     .def("delay_automaton", &automaton::delay_automaton)
     .def("determinize", &automaton::determinize, (arg("algo") = "auto"))
-    .def("difference", &automaton::difference)
+    .def("difference", &automaton::difference, (arg("lazy") = false))
     .def("eliminate_state", &automaton::eliminate_state, (arg("state") = -1))
     .def("_evaluate", static_cast<evaluate_t>(&automaton::evaluate))
-    .def("_evaluate", static_cast<evaluate_polynomial_t>(&automaton::evaluate))
+    .def("_evaluate", static_cast<evaluate_polynomial_t>(&automaton::evaluate),
+         (arg("polynomial"), arg("algo") = "auto"))
+    .def("_evaluate", static_cast<evaluate_stream_t>(&automaton::evaluate),
+         (arg("data"), arg("format"), arg("filename")))
     .def("factor", &automaton::factor)
     .def("filter", &automaton_filter)
     .def("_format", &format<automaton>)
@@ -410,6 +621,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("lightest_automaton",
          &automaton::lightest_automaton,
          (arg("num") = 1U, arg("algo") = "auto"))
+    .def("lightest_iter", &automaton::lightest_iter)
     .def("minimize", &automaton::minimize, (arg("algo") = "auto"))
     .def("multiply", static_cast<automaton_multiply_t>(&automaton::multiply),
          (arg("algo") = "auto"))
@@ -419,6 +631,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("normalize", &automaton::normalize)
     .def("num_components", &automaton::num_components)
     .def("pair", &automaton::pair, (arg("keep_initials") = false))
+    .def("path_index", &automaton::path_index, (arg("landmarks") = 4U))
     .def("prefix", &automaton::prefix)
     .def("partial_identity", &automaton::partial_identity)
     .def("project", &automaton::project)
@@ -433,6 +646,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("reduce", &automaton::reduce)
     .def("rweight", &automaton::rweight,
          (arg("weight"), arg("algo") = "auto"))
+    .def("sample", &automaton_sample, (arg("num"), arg("length") = -1))
     .def("scc", &automaton::scc, (arg("algo") = "auto"))
     .def("shortest", &automaton::shortest,
          (arg("num") = boost::optional<unsigned>(),
@@ -447,6 +661,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("synchronize", &automaton::synchronize)
     .def("synchronizing_word",
          &automaton::synchronizing_word, (arg("algo") = "greedy"))
+    .def("to_arrays", &automaton_to_arrays)
     .def("transpose", &automaton::transpose)
     .def("trim", &automaton::trim)
     .def("_tuple", &automaton_tuple).staticmethod("_tuple")
@@ -455,6 +670,24 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("weight_series", &automaton::weight_series)
     ;
 
+  {
+    auto c = bp::class_<array_buffer>("array_buffer", bp::no_init)
+      .def("__len__", &array_buffer_len)
+      ;
+    reinterpret_cast<PyTypeObject*>(c.ptr())->tp_as_buffer
+      = &array_buffer_procs;
+  }
+
+  bp::class_<automaton_arrays, std::shared_ptr<automaton_arrays>>
+    ("automaton_arrays", bp::no_init)
+    .add_property("states", &arrays_states)
+    .add_property("sources", &arrays_sources)
+    .add_property("destinations", &arrays_destinations)
+    .add_property("labels", &arrays_labels)
+    .add_property("weights", &arrays_weights)
+    .add_property("label_names", &arrays_label_names)
+   ;
+
   bp::class_<context>("context", bp::no_init)
     .def(bp::init<const std::string&>())
     .def("cerny", &context::cerny)
@@ -462,10 +695,14 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("cotrie", static_cast<string_trie_t>(&context::cotrie),
          (arg("data") = "", arg("format") = "default",
           arg("filename") = ""))
+    .def("dawg", static_cast<string_trie_t>(&context::dawg),
+         (arg("data") = "", arg("format") = "default",
+          arg("filename") = ""))
     .def("de_bruijn", &context::de_bruijn)
     .def("divkbaseb", &context::divkbaseb)
     .def("double_ring", &context_double_ring)
     .def("format", &format<context>)
+    .def("_from_arrays", &context_from_arrays)
     .def("join", &context::join)
     .def("ladybird", &context::ladybird)
     .def("levenshtein", &context::levenshtein)
@@ -543,6 +780,8 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("lweight", &expression::lweight)
     .def("less_than", &expression::less_than)
     .def("lift", &expression::lift)
+    .def("matcher", &expression::matcher,
+         (arg("capacity") = 1024U, arg("algo") = "auto"))
     .def("multiply", static_cast<multiply_t<expression>>(&expression::multiply))
     .def("multiply",
          static_cast<multiply_repeated_t<expression>>(&expression::multiply),
@@ -578,6 +817,25 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("rdivide", &label::rdivide)
    ;
 
+  bp::class_<lightest_iterator>("lightest_iterator", bp::no_init)
+    .def("__iter__", bp::objects::identity_function())
+    .def("__next__", &lightest_iterator_next)
+   ;
+
+  bp::class_<expression_matcher>("expression_matcher", bp::no_init)
+    .def("context", &matcher_context)
+    .def("_match", &matcher_match)
+    .def("_match", &matcher_match_list)
+    .def("_search", &matcher_search)
+    .def("_search", &matcher_search_list)
+    .def("size", &expression_matcher::size)
+   ;
+
+  bp::class_<lightest_path_index>("lightest_path_index", bp::no_init)
+    .def("query", &path_index_query,
+         (arg("src"), arg("dst"), arg("algo") = "auto"))
+   ;
+
   bp::class_<polynomial>("polynomial", bp::no_init)
     .def(bp::init<const context&, const std::string&>())
     .def("add", &polynomial::add)
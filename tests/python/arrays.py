@@ -0,0 +1,113 @@
+#! /usr/bin/env python
+
+import array
+import vcsn
+from test import *
+
+def check(aut):
+    'Round trip of `aut` via arrays.'
+    a = aut.to_arrays()
+    CHECK_EQ(len(a.sources), len(a.weights))
+    res = vcsn.automaton.from_arrays(aut.context(),
+                                     a.sources, a.destinations,
+                                     a.labels, a.weights,
+                                     label_names=a.label_names,
+                                     states=a.states)
+    CHECK_ISOMORPHIC(aut, res)
+    return a
+
+
+## --------------- ##
+## to_arrays.      ##
+## --------------- ##
+
+a = check(vcsn.automaton('''
+context = lal(abc), q
+$ -> 0 <1/2>
+0 -> 1 <3>a, <2>b
+1 -> 2 c
+2 -> $ <1/4>
+'''))
+CHECK_EQ([0, 1, 2], memoryview(a.states).tolist())
+CHECK_EQ(['a', 'b', 'c'], a.label_names)
+CHECK_EQ([-1, 0, 0, 1, 2], memoryview(a.sources).tolist())
+CHECK_EQ([0, 1, 1, 2, -1], memoryview(a.destinations).tolist())
+CHECK_EQ([-1, 0, 1, 2, -1], memoryview(a.labels).tolist())
+CHECK_EQ([0.5, 3, 2, 1, 0.25], memoryview(a.weights).tolist())
+CHECK_EQ('i', memoryview(a.labels).format)
+CHECK_EQ('d', memoryview(a.weights).format)
+CHECK_EQ(5, len(a.labels))
+
+# The buffers keep the arrays alive.
+labels = vcsn.automaton('''
+context = lal(ab), b
+$ -> 0
+0 -> 0 a, b
+0 -> $
+''').to_arrays().labels
+CHECK_EQ([-1, 0, 1, -1], memoryview(labels).tolist())
+
+for ctx in ['lal(abc), b', 'lal(abc), z', 'lal(abc), zmin', 'law(abc), q']:
+    check(vcsn.context(ctx).random_automaton(10, density=.3))
+
+XFAIL(lambda: vcsn.automaton('''
+context = lal(ab), expressionset<lal(xy), q>
+$ -> 0
+0 -> $
+''').to_arrays(),
+      'weights are not numbers')
+
+
+## ----------------- ##
+## from_arrays.      ##
+## ----------------- ##
+
+exp = vcsn.automaton('''
+context = lal(abc), z
+$ -> 0
+0 -> 1 <2>a
+1 -> 1 b
+1 -> $ <3>
+''')
+
+# Labels as strings, any sequence of numbers.
+CHECK_EQ(exp,
+         vcsn.automaton.from_arrays('lal(abc), z',
+                                    [-1, 0, 1, 1],
+                                    [0, 1, 1, -1],
+                                    [None, 'a', 'b', None],
+                                    [1, 2, 1, 3]))
+
+# Buffers, and no weights.
+CHECK_EQ(vcsn.automaton('''
+context = lal(abc), z
+$ -> 0
+0 -> 1 a
+1 -> 1 b
+1 -> $
+'''),
+         vcsn.automaton.from_arrays(vcsn.context('lal(abc), z'),
+                                    array.array('i', [-1, 0, 1, 1]),
+                                    array.array('i', [0, 1, 1, -1]),
+                                    array.array('i', [-1, 0, 1, -1]),
+                                    label_names=['a', 'b']))
+
+# Extra states.
+CHECK_EQ(3, vcsn.automaton.from_arrays('lal(abc), b',
+                                       [-1], [0], [None],
+                                       states=[0, 1, 2]).info('number of states'))
+
+XFAIL(lambda: vcsn.automaton.from_arrays('lal(abc), z',
+                                         [0], [1], [3], label_names=['a']),
+      'from_arrays: invalid label for transition 0: 3')
+XFAIL(lambda: vcsn.automaton.from_arrays('lal(abc), z',
+                                         [0], [1], ['a'], [1.5]),
+      'Z: invalid weight: 1.5')
+XFAIL(lambda: vcsn.automaton.from_arrays('lal(abc), z',
+                                         [0, 1], [1], ['a']),
+      'from_arrays: arrays of different sizes')
+# The number of states is computed from valid sources and destinations
+# only.
+XFAIL(lambda: vcsn.automaton.from_arrays('lal(abc), z',
+                                         [-3], [1], ['a']),
+      'from_arrays: invalid transition 0: -3 -> 1')
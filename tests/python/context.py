@@ -1,9 +1,11 @@
 #! /usr/bin/env python
 
 import re
+import subprocess
 
 import vcsn
 from test import *
+from vcsn_cxx import configuration as config
 
 def check(ctx, exp=None, format="sname"):
     c = vcsn.context(ctx)
@@ -75,6 +77,13 @@ CHECK_EQ(r'''\x01 + \x02 + \x03 + \x04 + \x05 + \x06 + \x07 + \x08 + \x09 + \n +
 
 check('lal_char(ab), q', 'letterset<char_letters(ab)>, q')
 
+# letterset with a fixed range of chars.
+check(r'lal_char_ascii, b',          r'letterset<char_range(\x01-\x7f)>, b')
+check(r'lal<char_range(\x61-z)>, b', r'letterset<char_range(a-z)>, b')
+check(r'lal<char_range(a-z)>, b',    r'{a-z} -> B', 'text')
+XFAIL(lambda: vcsn.context('lal<char_range(z-a)>, b'),
+      'char_range: invalid range: (z-a)')
+
 
 ## ------------------- ##
 ## LabelSet: wordset.  ##
@@ -82,6 +91,25 @@ check('lal_char(ab), q', 'letterset<char_letters(ab)>, q')
 
 check('wordset<string_letters>, b', 'wordset<string_letters()>, b')
 
+# Strings represented by integer ids.  Letters are ordered by first
+# occurrence in the process, not alphabetically: run in fresh
+# processes, so that the previous tests do not intern strings.
+def fresh(ctx, *before):
+    '''The sname of `ctx`, built in a new process, after the contexts
+    `before`.'''
+    code = ['import vcsn']
+    code += ['vcsn.context({!r})'.format(c) for c in before]
+    code += ['print(vcsn.context({!r}).format("sname"))'.format(ctx)]
+    return subprocess.check_output([config('configuration.python'),
+                                    '-c', '\n'.join(code)]) \
+                     .decode('utf-8').strip()
+
+CHECK_EQ("letterset<string_id_letters('zz'a)>, b",
+         fresh("lal<string_id('zz'a)>, b"))
+CHECK_EQ("letterset<string_id_letters(a'zz')>, b",
+         fresh("lal<string_id('zz'a)>, b", 'lal<string_id(a)>, b'))
+check('wordset<string_id>, b',    'wordset<string_id_letters()>, b')
+
 
 ## ------------------------- ##
 ## LabelSet: expressionset.  ##
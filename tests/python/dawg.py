@@ -0,0 +1,78 @@
+#! /usr/bin/env python
+
+import itertools
+import os
+import vcsn
+from test import *
+
+def check(ctx, data, exp=None, format='default'):
+    '''Check that `dawg` is the minimal `trie`, via a string and via a
+    file.'''
+    print(ctx, data)
+    c = vcsn.context(ctx)
+    a = c.dawg(data, format=format)
+    if exp is not None:
+        CHECK_EQ(exp, a.format('daut'))
+    if ctx.startswith('law'):
+        CHECK(a.is_deterministic())
+    CHECK_ISOMORPHIC(c.trie(data, format=format).minimize(), a)
+
+    # Not 'words.txt', which other tests may use concurrently.
+    fn = 'dawg.words.txt'
+    with open(fn, 'w') as file:
+        print(data, file=file, end='')
+    CHECK_EQ(a.format('daut'),
+             c.dawg(filename=fn, format=format).format('daut'))
+    os.remove(fn)
+
+
+# Boolean words: common suffixes are shared.
+check('law_char, b', 'bad\nbd\nd\n',
+      r'''context = letterset<char_letters(abd)>, b
+$ -> 3
+0 -> $
+1 -> 0 d
+2 -> 0 d
+2 -> 1 a
+3 -> 0 d
+3 -> 2 b''',
+      format='words')
+
+# Weighted words: only the states with the same futures are merged.
+check('law_char, q', '<2>\\e\n<3>a\n<4>ab\n<6>abc\n<3>b\n<6>bc\n',
+      r'''context = letterset<char_letters(abc)>, q
+$ -> 4
+0 -> $ <6>
+1 -> $ <4>
+1 -> 0 c
+2 -> $ <3>
+2 -> 1 b
+3 -> $ <3>
+3 -> 0 c
+4 -> $ <2>
+4 -> 2 a
+4 -> 3 b''')
+
+# Repeated words: their weights are added, possibly to zero.
+check('law_char, z', '<2>a\n<-2>a\n<3>ab\nb\nb\n')
+check('law_char, zmin', '<2>ab\n<3>b\n<2>cb\n')
+
+# Empty series.
+CHECK_EQ(0, vcsn.context('law_char, b').dawg('').info('number of states'))
+
+# Multitape: sorted by tuples of letters.
+check('lat<law_char, law_char>, q',
+      '<40>forty|quarante\n<14>forteen|quatorze\n<2>two|deux\n<3>three|trois\n')
+
+# The words on {a, b, c} of length at most 6 with as many a's as b's.
+words = [''.join(w)
+         for n in range(1, 7)
+         for w in itertools.product('abc', repeat=n)
+         if w.count('a') == w.count('b')]
+check('law_char, b', ''.join(w + '\n' for w in sorted(words)),
+      format='words')
+
+XFAIL(lambda: vcsn.context('law_char, b').dawg('ab\nb\na\n', format='words'),
+      'dawg: words are not sorted: a after b')
+XFAIL(lambda: vcsn.context('law_char, b').dawg('abc\nab\n', format='words'),
+      'dawg: words are not sorted: ab after abc')
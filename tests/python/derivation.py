@@ -40,6 +40,11 @@ def check_dt(r, exp):
     'Check derived-term automaton.'
     for algo in ['derivation', 'expansion', 'lazy,expansion']:
         check_derived_term(r, exp, algo)
+    # The position-based construction builds the same automaton, but
+    # the states may be numbered differently.
+    if not r.is_extended():
+        print('{}: checking: {:u}.derived_term("positions")'.format(here(), r))
+        CHECK_ISOMORPHIC(meaut(exp, 'gv'), r.derived_term('positions'))
 
 def check_bdt(r, exp):
     'Check broken derived-term automaton.'
@@ -146,6 +151,14 @@ XFAIL(lambda: vcsn.Q.expression('a**').derived_term('derivation'),
   while computing constant-term of: a**
   while computing derived-term of: a**''')
 
+XFAIL(lambda: vcsn.Q.expression('a**').derived_term('positions'),
+      r'''Q: value is not starrable: 1
+  while computing derived-term of: a**''')
+
+XFAIL(lambda: vcsn.Q.expression('a&b').derived_term('positions'),
+      r'''positions: operator conjunction not supported: a&b
+  while computing derived-term of: a&b''')
+
 
 # Complement.
 check(r'\z{c}', 'a', r'\z{c}')
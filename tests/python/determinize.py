@@ -45,6 +45,31 @@ ctx = vcsn.context('lal_char(abc), b')
 check(ctx.ladybird(4), 'ladybird-4')
 check(ctx.ladybird(8), 'ladybird-8')
 
+# Fixed alphabets use arrays instead of maps: the result is the same,
+# but for the context.
+def body(aut):
+    return aut.format('daut').split('\n', 1)[1]
+
+for algo in ['boolean', 'weighted']:
+    aut = vcsn.context('lal<char_range(a-c)>, b').ladybird(6)
+    CHECK_EQ(body(vcsn.context('lal_char(abc), b').ladybird(6)
+                  .determinize(algo)),
+             body(aut.determinize(algo)))
+
+# Strings as ids.  The order of the letters, hence the numbering of
+# the states, may differ from lal<string>, but not the language.
+e = "('foo'+'bar')*'foo'('foo'+'bar'){2}"
+for algo in ['boolean', 'weighted']:
+    ref = vcsn.context('lal<string>, b').expression(e).standard()
+    aut = vcsn.context('lal<string_id>, b').expression(e).standard()
+    ref = ref.determinize(algo)
+    aut = aut.determinize(algo)
+    CHECK(aut.is_deterministic())
+    CHECK_EQ(ref.info('number of states'), aut.info('number of states'))
+    for w in ["'foo''foo''bar'", "'bar''foo''bar''foo'", "'foo''bar'",
+              "'foo''foo'"]:
+        CHECK_EQ(ref.evaluate(w), aut.evaluate(w))
+
 
 ## ------------------------------- ##
 ## Simple deterministic automata.  ##
@@ -14,6 +14,10 @@ def check(lhs, rhs, exp):
     l = ctx.expression(lhs).derived_term()
     r = ctx.expression(rhs).derived_term()
     CHECK_EQ(exp, str((l - r).expression()))
+    # Lazy: the states are computed on demand.
+    d = l.difference(r, lazy=True)
+    CHECK_EQ(exp == r'\z', d.is_useless())
+    CHECK_EQUIV(l - r, d.accessible())
 
 check('(a+b)*', 'b*',            'b*a(a+b)*')
 check('(a+b)*', '(a+b)*b(a+b)*', 'a*')
@@ -22,3 +26,14 @@ check('(a+b)*', '(a+b)*',        r'\z')
 check('a(ba)*', '(ab)*a', r'\z')
 
 check('(?@lal_char(ab), z)(<2>a+<3>b)*', '(a+b)*a(a+b)*', '(<3>b)*')
+
+# Weighted rhs: no implicit sink, the weights of rhs are kept.
+zc = vcsn.context('lal_char(ab), z')
+l = zc.expression('(<2>a+<3>b)*').standard()
+r = zc.expression('(<5>a)*').standard()
+CHECK_EQUIV(l.conjunction(r.complete().complement()), l - r)
+
+# Laziness requires Boolean weights on rhs.
+z = vcsn.context('lal_char(ab), z').expression('(a+b)*').standard()
+XFAIL(lambda: z.difference(z, lazy=True),
+      'difference: lazy: requires a free Boolean rhs')
@@ -1,5 +1,7 @@
 #! /usr/bin/env python
 
+import itertools
+import os
 import vcsn
 from test import *
 
@@ -233,6 +235,31 @@ check(a_epsilon, 'abcef', '0')
 check(a_epsilon, 'abc', '0')
 check(a_epsilon, 'abcd', '0')
 
+# Several spontaneous paths to the same state: their weights are
+# added.
+ctx = vcsn.context('lan_char(ab), z')
+a = vcsn.automaton('''
+context = "lan_char(ab), z"
+$ -> 0
+0 -> 1 <2>\\e
+0 -> 2 <3>\\e
+1 -> 3 \\e
+2 -> 3 \\e
+3 -> 3 b
+3 -> 4 a
+4 -> $
+''')
+check(a, 'a', '5')
+check(a, 'bba', '5')
+check(a, 'ab', '0')
+
+# Exponentially many paths, but a linear number of (state, offset)
+# pairs.
+ctx = vcsn.context('law_char(ab), zmin')
+a = ctx.expression('(<1>a+<1>b+<1>ab)*', 'associative').automaton()
+check(a, 'ab' * 100, '100')
+check(a, 'ab' * 100 + 'ba', '102')
+
 ## -------------------- ##
 ## lat<lan, lan>, zmin  ##
 ## -------------------- ##
@@ -271,3 +298,40 @@ a = ctx.expression('<2>(ab(<3>cd)*(ef))<5>', 'associative').automaton()
 check(a, "<2>abcdcdef+abcdef", '210')
 check(a,"abcdef+abcdcdcdef", '300')
 check(a, "<0>abcdcdef+abcdef", '30')
+XFAIL(lambda: a.evaluate(ctx.polynomial('ab'), algo='trie'),
+      'evaluate: trie: requires a free labelset')
+
+
+## check AUTOMATON FILE EXP
+## ------------------------
+
+def check(aut, data, exp, format='default'):
+    # Not 'words.txt', which other tests may use concurrently.
+    fn = 'evaluate.words.txt'
+    with open(fn, 'w') as file:
+        print(data, file=file, end='')
+    CHECK_EQ(ctx.weight(exp), aut.evaluate(filename=fn, format=format))
+    os.remove(fn)
+
+check(a, '<2>abcdcdef\nabcdef\n', '210')
+check(a, 'abcdef\nabcdcdcdef\n', '300', format='words')
+
+
+## -------------------------------------- ##
+## lal_char, z: sharing common prefixes.  ##
+## -------------------------------------- ##
+
+# All the words on {a, b, c} of length at most 6.
+words = [''.join(w)
+         for n in range(7)
+         for w in itertools.product('abc', repeat=n)]
+ctx = vcsn.context('lal_char(abc), z')
+p = ctx.word_context().polynomial('+'.join(w or r'\e' for w in words))
+for a, exp in [(ctx.de_bruijn(3), '351'),
+               (ctx.ladybird(4), None)]:
+    exp = a.evaluate(p, algo='monomials') if exp is None else ctx.weight(exp)
+    CHECK_EQ(exp, a.evaluate(p, algo='monomials'))
+    CHECK_EQ(exp, a.evaluate(p, algo='trie'))
+    CHECK_EQ(exp, a.evaluate(p))
+    check(a, ''.join((w or r'\e') + '\n' for w in sorted(words)), str(exp),
+          format='words')
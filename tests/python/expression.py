@@ -52,6 +52,14 @@ check(e, 'law, q', 'none', '(a+b)+<1/2>a')
 check(e, 'lan, r', 'none', '(a+b)+<0.5>a')
 check(e, 'law, r', 'linear', '<1.5>a+b')
 
+e = qexp('(((a+b)+<-1>a)+c)+b', 'none')
+check(e, q, 'associative', 'a+b+<-1>a+c+b')
+check(e, q, 'linear', '<2>b+c')
+
+e = qexp('(a(b+c))d', 'none')
+check(e, q, 'associative', 'a(b+c)d')
+check(e, q, 'distributive', 'abd+acd')
+
 check(qexp(r'\z*', 'none'), q, 'none', r'\z*')
 check(qexp(r'\z*', 'none'), q, 'linear', r'\e')
 
@@ -43,6 +43,21 @@ check(True, 'a+b+a', '<2>a+b')
 check(True, 'a*+b+a*', '<2>a*+b')
 check(False, 'a*+a*', 'a*')
 
+# Large alphabets: the automata are not completed, the missing
+# transitions implicitly lead to a sink.  Four words of 250 letters:
+# about 1,000 states, and 1,000 letters, so completion would add about
+# a million transitions.
+ctx = vcsn.context('lal<string>, b')
+letters = ["'w{}'".format(i) for i in range(1000)]
+words = [''.join(letters[i::4]) for i in range(4)]
+a1 = ctx.expression('+'.join(words)).standard()
+a2 = ctx.expression('+'.join(reversed(words))).standard()
+a3 = ctx.expression('+'.join(words[1:])).standard()
+CHECK(a1.is_equivalent(a2))
+# The letters of words[0] are not in the alphabet of a3.
+CHECK(not a1.is_equivalent(a3))
+CHECK(not a3.is_equivalent(a1))
+
 ctx = vcsn.context('lat<lan_char, lan_char>,b')
 a = ctx.expression('a|x')
 # Don't expect more than the first error: clang produces more of them
@@ -23,6 +23,17 @@ check('aaa+<2>b', '0', 'aaa')
 check('a(<1>b)*', '0', 'a')
 check('[ab]', '0', 'a')
 
+ctx = vcsn.context('lal_char, zmin')
+check('<3>a+<2>b+<5>c', '2', 'b')
+# Bellman-Ford is needed on negative weights, Dijkstra is used otherwise.
+aut = ctx.expression('<3>a+<-2>b').automaton()
+CHECK_EQ('-2', aut.lightest_automaton(1, 'auto').weight_series())
+aut = ctx.expression('<3>a+<2>b').automaton()
+CHECK_EQ('2', aut.lightest_automaton(1, 'auto').weight_series())
+
+ctx = vcsn.context('lal_char, rmin')
+check('<3.5>a+<2.5>b+<5>c', '2.5', 'b')
+
 
 def k_check(orig, new, num):
   aut = ctx.expression(orig).automaton()
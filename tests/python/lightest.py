@@ -1,5 +1,6 @@
 #! /usr/bin/env python
 
+from itertools import islice
 import vcsn
 from test import *
 
@@ -7,11 +8,12 @@ from test import *
 algos = ['auto', 'a-star', 'bellman-ford', 'breadth-first', 'dijkstra', 'yen']
 
 # The algos that can compute the k lightest paths.
-k_algos = ['auto', 'breadth-first', 'yen', 'eppstein']
+k_algos = ['auto', 'breadth-first', 'yen', 'eppstein', 'lazy-eppstein']
 
 def check_aut(aut, re, num, exp, tests = []):
   for algo in tests if tests else algos if num == 1 else k_algos:
-      if algo != 'eppstein' or weightset_of(ctx) in ['nmin', 'rmin', 'zmin']:
+      if (algo not in ['eppstein', 'lazy-eppstein']
+          or weightset_of(ctx) in ['nmin', 'rmin', 'zmin']):
           print(algo + ':' + re)
           p = aut.lightest(num=num, algo=algo)
           CHECK_EQ(exp, p)
@@ -24,7 +26,7 @@ check(r'\z', 3, r'\z', k_algos)
 check(r'\e', 3, r'<0>\e', k_algos)
 check('a+b', 2, '<0>a + <0>b', k_algos)
 check('ababab', 10, '<0>ababab', k_algos)
-check('(<1>a+<1>b)*', 7, r'<0>\e + <1>a + <1>b + <2>aa + <2>ab + <2>ba + <2>bb', ['auto', 'eppstein'])
+check('(<1>a+<1>b)*', 7, r'<0>\e + <1>a + <1>b + <2>aa + <2>ab + <2>ba + <2>bb', ['auto', 'eppstein', 'lazy-eppstein'])
 check('<4>a+(<1>a<1>b)+<1>c+<2>d', 1, '<1>c', k_algos)
 
 aut = vcsn.automaton('''
@@ -42,7 +44,21 @@ $ -> 0
 ''')
 
 check_aut(aut, "notebook example", 5,
-          '<6>a + <5>ab + <4>abcd + <6>abbcd + <8>abbbcd', ['auto', 'eppstein'])
+          '<6>a + <5>ab + <4>abcd + <6>abbcd + <8>abbbcd', ['auto', 'eppstein', 'lazy-eppstein'])
+
+# lightest_iter: the paths, lightest first, on demand.
+ps = list(islice(aut.lightest_iter(), 7))
+CHECK_EQ(['<4>abcd', '<5>ab', '<6>a', '<6>abbcd', '<8>abbbcd',
+          '<10>abbbbcd', '<12>abbbbbcd'],
+         sorted([str(p) for p in ps], key=lambda p: (int(p[1:p.index('>')]), p)))
+# This automaton has no path.
+CHECK_EQ([], list(vcsn.context('lal_char, nmin').expression(r'\z')
+                  .standard().lightest_iter()))
+XFAIL(lambda: vcsn.automaton('''
+context = "lal_char, z"
+$ -> 0
+0 -> $
+''').lightest_iter(), 'lightest_iter: invalid weightset: Z')
 
 ctx = vcsn.context('lal_char(abcd), z')
 check('[a-d]?{5}', 5, r'\e + aa + ab + ac + ad', ['auto'])
@@ -61,7 +77,7 @@ check(r'\z', 3, r'\z')
 check(r'\e', 3, r'<0>\e')
 check('a+b', 2, '<0>a + <0>b')
 check('ababab', 10, '<0>ababab')
-check('(<1>a+<1>b)*', 7, r'<0>\e + <1>a + <1>b + <2>aa + <2>ab + <2>ba + <2>bb', ['auto', 'eppstein'])
+check('(<1>a+<1>b)*', 7, r'<0>\e + <1>a + <1>b + <2>aa + <2>ab + <2>ba + <2>bb', ['auto', 'eppstein', 'lazy-eppstein'])
 check('<4>a+(<1>a<1>b)+<1>c+<2>d', 1, '<1>c')
 
 zero = ctx.expression(r'\z').standard()
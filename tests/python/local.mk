@@ -21,6 +21,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
 %C%_TESTS =                                     \
   %D%/accessible.py                             \
   %D%/add.py                                    \
+  %D%/arrays.py                                 \
   %D%/automaton.py                              \
   %D%/chain.py                                  \
   %D%/compare.py                                \
@@ -31,6 +32,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/conjunction.py                            \
   %D%/constant-term.py                          \
   %D%/context.py                                \
+  %D%/dawg.py                                   \
   %D%/demangle.py                               \
   %D%/derivation.py                             \
   %D%/determinize.py                            \
@@ -64,12 +66,14 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/lift.py                                   \
   %D%/lightest-automaton.py                     \
   %D%/lightest.py                               \
+  %D%/matcher.py                                \
   %D%/minimize.py                               \
   %D%/multiply.py                               \
   %D%/name.py                                   \
   %D%/normalize.py                              \
   %D%/num-tapes.py                              \
   %D%/partial-identity.py                       \
+  %D%/path-index.py                             \
   %D%/polynomial.py                             \
   %D%/power.py                                  \
   %D%/prefix.py                                 \
@@ -78,6 +82,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/properlazy.py                             \
   %D%/push-weights.py                           \
   %D%/reduce.py                                 \
+  %D%/sample.py                                 \
   %D%/scc.py                                    \
   %D%/shortest.py                               \
   %D%/shuffle.py                                \
@@ -0,0 +1,68 @@
+#! /usr/bin/env python
+
+import vcsn
+from test import *
+
+# check CONTEXT EXP WORDS
+# -----------------------
+# Check that the matcher of EXP agrees with the derived-term automata
+# of EXP and of [^]*EXP[^]*, with several cache capacities.
+def check(ctx, exp, words):
+    c = vcsn.context(ctx)
+    e = c.expression(exp)
+    a = e.derived_term()
+    f = c.expression('[^]*({})[^]*'.format(exp)).derived_term()
+    # A capacity of 2 forces evictions.
+    for capacity in [2, 3, 1024]:
+        m = e.matcher(capacity)
+        for w in words:
+            CHECK_EQ(a(w), m.match(w))
+            CHECK_EQ(f(w), m.search(w))
+        CHECK_EQ([a(w) for w in words], m.match(words))
+        CHECK_EQ([f(w) for w in words], m.search(words))
+        CHECK(m.size() <= 2 * capacity)
+    # The bit-parallel matcher, on Boolean expressions.
+    if ctx.endswith(', b'):
+        m = e.matcher(algo='bitparallel')
+        CHECK_EQ([a(w) for w in words], m.match(words))
+        CHECK_EQ([f(w) for w in words], m.search(words))
+
+words = ['', 'a', 'b', 'ab', 'ba', 'aab', 'abab', 'bbbbab', 'abaabbbaab']
+
+check('lal(ab), b', '(a+b)*a(a+b){3}', words)
+check('lal(ab), b', '(a+b)*a(a+b){3}&{c}(a*b*)', words)
+check('lal(ab), z', '(<2>a+b)*(a+<3>b)', words)
+check('lal(ab), q', '(<1/2>a+<1/3>b)*ab', words)
+check('lal(ab), nmin', '(<1>a+<2>b)*<3>ab(<1>a)*', words)
+check('lal(ab), zmin', '(<-1>a+<2>b)*ab', words)
+
+# Letters outside the alphabet cannot be part of a match.
+m = vcsn.B.expression('ab').matcher()
+CHECK_EQ('1', m.search('xaby'))
+CHECK_EQ('0', m.search('axb'))
+CHECK_EQ('0', m.match('xab'))
+m = vcsn.Z.expression('ab').matcher()
+CHECK_EQ('2', m.search('abxab'))
+
+# Bit-parallel: the size is the number of positions.
+m = vcsn.B.expression('(a+b)*a(a+b){3}').matcher(algo='bitparallel')
+CHECK_EQ(9, m.size())
+CHECK_EQ('1', m.search('xabbb'))
+CHECK_EQ('0', m.search('abxbb'))
+CHECK_EQ('1', vcsn.B.expression('\\e').matcher(algo='bitparallel').search('x'))
+
+# More than 64 positions: several words per mask.
+check('lal(ab), b', '(a+b)*a(a+b){70}', ['a' * 71, 'b' + 'a' * 71, 'b' * 71])
+# Too many positions, or extended operators: deterministic derived terms.
+check('lal(ab), b', '(a+b)*a(a+b){260}', ['a' * 261, 'b' * 261])
+check('lal(ab), b', 'a*&(aa)*', words)
+
+# Errors.
+XFAIL(lambda: vcsn.B.expression('ab').matcher(1),
+      'matcher: capacity must be at least 2: 1')
+XFAIL(lambda: vcsn.context('lan_char, b').expression('ab').matcher(),
+      'matcher: unsupported labelset')
+XFAIL(lambda: vcsn.Z.expression('ab').matcher(algo='bitparallel'),
+      'matcher: bitparallel: requires a Boolean weightset')
+XFAIL(lambda: vcsn.B.expression('ab').matcher(algo='foo'),
+      'invalid matcher algorithm: foo')
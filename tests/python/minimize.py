@@ -4,7 +4,7 @@ import vcsn
 
 from test import *
 
-algos = ['hopcroft', 'moore', 'signature', 'weighted']
+algos = ['hopcroft', 'moore', 'portfolio', 'signature', 'weighted']
 
 def check(algo, aut, exp):
     if isinstance(algo, list):
@@ -49,6 +49,7 @@ check(algos, a, exp)
 a = meaut('incomplete-non-trim.gv')
 #xfail('brzozowski', a)
 xfail('moore',      a)
+xfail('portfolio',  a)
 xfail('signature',  a)
 xfail('weighted',   a)
 
@@ -90,6 +91,7 @@ a = vcsn.context('lal_char(a), b') \
 exp = metext('small-nfa.exp.gv')
 check('brzozowski', a, vcsn.automaton(exp))
 xfail('moore',      a)
+check('portfolio',  a, exp)
 check('signature',  a, exp)
 check('weighted',   a, exp)
 
@@ -99,11 +101,13 @@ exp = metext('small-z.exp.gv')
 xfail('brzozowski', a)
 xfail('moore',      a)
 xfail('signature',  a)
+check('portfolio',  a, exp)
 check('weighted',   a, exp)
 
 ## Non-lal automata.
 a = vcsn.context('law_char(a-c), b').expression('abc(bc)*+acb(bc)*').standard()
 exp = metext('nonlal.exp.gv')
+check('portfolio', a, exp)
 check('signature', a, exp)
 check('weighted',  a, exp)
 
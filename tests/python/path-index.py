@@ -0,0 +1,63 @@
+#! /usr/bin/env python
+
+import vcsn
+from test import *
+
+algos = ['auto', 'alt', 'bidirectional', 'tree']
+
+def check(idx, src, dst, exp):
+  # Twice, so that "auto" and "tree" also use the cached tree.
+  for _ in range(2):
+    for algo in algos:
+      CHECK_EQ(exp, idx.query(src, dst, algo))
+
+aut = vcsn.automaton('''
+context = "lal_char, nmin"
+$ -> 0
+0 -> 1 <1>a
+1 -> 2 <1>b
+0 -> 2 <5>c
+2 -> 3 <2>d
+3 -> 0 <1>e
+4 -> 4 <1>a
+3 -> $
+''')
+
+for landmarks in [0, 1, 4]:
+  idx = aut.path_index(landmarks)
+  check(idx, 0, 0, r'<0>\e')
+  check(idx, 0, 2, '<2>ab')
+  check(idx, 0, 3, '<4>abd')
+  check(idx, 3, 2, '<3>eab')
+  check(idx, 2, 0, '<3>de')
+  check(idx, 0, 4, r'\z')
+  check(idx, 4, 0, r'\z')
+
+idx = aut.path_index()
+XFAIL(lambda: idx.query(0, 5), 'path_index: invalid state: 5')
+XFAIL(lambda: idx.query(0, 1, 'foo'),
+      'invalid path_index algorithm: foo')
+
+# Real weights.
+aut = vcsn.automaton('''
+context = "lal_char, rmin"
+$ -> 0
+0 -> 1 <1.5>a
+1 -> 2 <1.5>b
+0 -> 2 <3.5>c
+2 -> $
+''')
+check(aut.path_index(), 0, 2, '<3>ab')
+
+# Only tropical weightsets, without negative weights.
+XFAIL(lambda: vcsn.automaton('''
+context = "lal_char, z"
+$ -> 0
+0 -> $
+''').path_index(), 'path_index: invalid weightset: Z')
+XFAIL(lambda: vcsn.automaton('''
+context = "lal_char, zmin"
+$ -> 0
+0 -> 1 <-1>a
+1 -> $
+''').path_index(), 'path_index: lightening weights are not supported')
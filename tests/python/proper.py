@@ -98,6 +98,22 @@ check_fail(metext('lan-z.fail.gv'))
 
 check(metext('lan-z.in.gv'), metext('lan-z.out.gv'))
 
+# Spontaneous paths that cancel out: the distance from 0 to 3 goes
+# from 1 to 0, and then to 1.  The closure must account for 3 once.
+a = vcsn.automaton(r'''
+context = lan_char(a), z
+$ -> 0
+0 -> 3 <1>\e
+0 -> 1 <1>\e
+1 -> 3 <-1>\e
+1 -> 2 <1>\e
+2 -> 3 <1>\e
+3 -> 4 a
+4 -> $
+''')
+for algo in algos:
+    CHECK_EQ('1', str(a.proper(algo=algo).evaluate('a')))
+
 
 ## ---------------------------------- ##
 ## law_char, zmin: invalid \e-cycle.  ##
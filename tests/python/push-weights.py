@@ -130,3 +130,13 @@ $ -> 0 <2>
 0 -> 4 <10>a
 ''')
 check(i, o)
+
+# Lightening cycles have no shortest distance.
+XFAIL(lambda: vcsn.automaton('''
+context = "lal_char(a), zmin"
+$ -> 0
+0 -> 1 <1>a
+1 -> 0 <-2>a
+1 -> $
+''').push_weights(),
+      'shortest_distance: automaton with a lightening cycle')
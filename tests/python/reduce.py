@@ -55,7 +55,7 @@ r = '<2>(<3>a+<5>b+<7>a)*<11>'
 
 def exp(ws):
     '''The expected result for the following tests.'''
-    if ws == 'z':
+    if ws in ['z', 'zh']:
         return '''digraph
 {
   vcsn_context = "letterset<char_letters(abc)>, z"
@@ -73,7 +73,7 @@ def exp(ws):
   I0 -> 0
   0 -> F0 [label = "<22>"]
   0 -> 0 [label = "<10>a, <5>b"]
-}'''
+}'''.replace(', z"', ', ' + ws + '"')
     else:
         # Using replace() instead of format() allows to use
         # bin/update-tests.
@@ -96,11 +96,17 @@ def exp(ws):
   0 -> 0 [label = "<10>a, <5>b"]
 }'''.replace('q', ws)
 
-for ws in ['z', 'q', 'r']:
+for ws in ['z', 'zh', 'q', 'qh', 'r']:
     ctx = vcsn.context('lal_char(abc), ' + ws)
     a = ctx.expression(r, 'associative').standard()
     check_reduce(a, exp(ws))
 
+# zh and qh promote to GMP instead of overflowing.
+for ws in ['zh', 'qh']:
+    a = vcsn.context('lal_char(ab), ' + ws) \
+            .expression('(<4294967296>a)*<4294967296>b').standard()
+    CHECK_EQ('79228162514264337593543950336', a.reduce()('aab'))
+
 a = vcsn.context('lat<lal_char(abc),lal_char(xyz)>, z') \
     .expression("<2>(<3>(a|x)+<5>(b|y)+<7>(a|x))*<11>", 'associative') \
     .standard()
@@ -0,0 +1,112 @@
+#! /usr/bin/env python
+
+import collections
+import vcsn
+from test import *
+
+# check_freq AUT NUM LENGTH FREQS
+# -------------------------------
+# Draw NUM words of AUT, and check that their frequencies are those
+# of FREQS (a dict from words to probabilities), with a tolerance of
+# six standard deviations.
+def check_freq(aut, num, length, freqs):
+    ws = aut.sample(num, length)
+    CHECK_EQ(num, len(ws))
+    count = collections.Counter(str(w) for w in ws)
+    for w, p in freqs.items():
+        exp = num * p
+        dev = 6 * (num * p * (1 - p)) ** .5
+        if abs(count[w] - exp) <= dev:
+            PASS()
+        else:
+            FAIL('{}: {} draws, expected {}'.format(w, count[w], exp))
+    if sum(freqs.values()) == 1:
+        CHECK_EQ(set(), set(count) - set(freqs))
+
+
+## --------- ##
+## Boolean.  ##
+## --------- ##
+
+b = vcsn.context('lal(ab), b')
+
+# Uniform among the words of length 3.
+check_freq(b.expression('(a+b)*a(a+b)').standard(), 4000, 3,
+           {w: 1/4 for w in ['aaa', 'aab', 'baa', 'bab']})
+
+# Non deterministic: `aa` has two accepting paths, yet it is not more
+# likely than the others.
+a = b.expression('(a+b)*a(a+b)*').standard()
+CHECK(not a.is_deterministic())
+check_freq(a, 3000, 2, {w: 1/3 for w in ['aa', 'ab', 'ba']})
+
+# Long words: the counts exceed machine integers.
+ws = b.expression('[^]*').standard().sample(10, 100)
+CHECK_EQ([100] * 10, [len(str(w)) for w in ws])
+
+# The empty word.
+CHECK_EQ(['\\e'], [str(w) for w in b.expression('a*').standard().sample(1, 0)])
+
+
+## ---------------- ##
+## Probabilistic.   ##
+## ---------------- ##
+
+# The initial state is final with probability 0.2, and loops on a and
+# b with probabilities 0.5 and 0.3.
+a = vcsn.context('lal(ab), r').expression('(<0.5>a+<0.3>b)*<0.2>').standard()
+check_freq(a, 20000, -1, {'\\e': .2, 'a': .1, 'b': .06, 'ab': .03})
+# Given a length, conditioned on it.
+check_freq(a, 4000, 1, {'a': 5/8, 'b': 3/8})
+check_freq(a, 4000, 2, {'aa': 25/64, 'ab': 15/64, 'ba': 15/64, 'bb': 9/64})
+
+# Same with log weights, i.e., -log of probabilities.
+a = vcsn.context('lal(ab), log').expression(
+    '(<1.3862943611>a+<1.3862943611>b)*<0.6931471806>').standard()
+check_freq(a, 20000, -1, {'\\e': .5, 'a': .125, 'b': .125})
+check_freq(a, 2000, 3, {'aba': 1/8})
+
+# States that are not coaccessible are never reached.
+a = vcsn.automaton('''
+context = lal(ab), r
+$ -> 0
+0 -> 0 <0.5>a
+0 -> 1 <0.5>b
+0 -> 2 <1>a
+1 -> $
+''')
+check_freq(a, 4000, -1, {'b': .5, 'ab': .25})
+
+# Weights that are not probabilities: the transitions are weighted by
+# the total weight of the words that follow them.  Here `a` weighs .5
+# and `b` .25, so `a` is twice more likely, even though both leave 0
+# with the same weight.
+a = vcsn.automaton('''
+context = lal(ab), r
+$ -> 0
+0 -> 1 <0.5>a
+0 -> 2 <0.5>b
+1 -> $
+2 -> $ <0.5>
+2 -> 3 <0.5>a
+''')
+check_freq(a, 6000, -1, {'a': 2/3, 'b': 1/3})
+# The weights of the words need not sum to one: here, 4.
+a = vcsn.context('lal(ab), r').expression('(<0.25>a+<0.25>b)*<2>a').standard()
+check_freq(a, 4000, -1, {'a': 1/2, 'aa': 1/8, 'ba': 1/8})
+
+
+## -------- ##
+## Errors.  ##
+## -------- ##
+
+XFAIL(lambda: b.expression('a*').standard().sample(1),
+      'sample: Boolean automata require a length')
+XFAIL(lambda: b.expression('a').standard().sample(1, 2),
+      'sample: no accepted word of length 2')
+XFAIL(lambda: vcsn.context('lal(ab), r').expression('\\z').standard().sample(1),
+      'sample: no accepted word')
+XFAIL(lambda: vcsn.context('lal(ab), r').expression('(a+b)*').standard().sample(1),
+      'sample: the weights of the words do not converge')
+XFAIL(lambda: vcsn.context('lal(ab), z').expression('a').standard().sample(1),
+      'sample: unsupported context')
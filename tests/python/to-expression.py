@@ -34,6 +34,17 @@ check_aut(load('lal_char_zmin/slowgrow.gv'),
           '(a+b)*b(<1>a)*b(a+<1>(a(<1>a)*b))*',
           'naive')
 
+# "best" runs the heuristics concurrently, and keeps the smallest
+# result, the first one in case of ties.  With non-linear identities,
+# the heuristics may give up early.
+for a in [meaut('a.gv'), load('lal_char_z/d1.gv'),
+          load('lal_char_zmin/slowgrow.gv')]:
+    for ids in ['associative', 'linear']:
+        res = [a.expression(ids, h)
+               for h in ['delgado', 'delgado_label', 'naive']]
+        exp = min(res, key=lambda e: e.info('size'))
+        CHECK_EQ(exp, a.expression(ids, 'best'))
+
 
 ## ------------------------------------ ##
 ## expression.standard().expression().  ##
@@ -14,3 +14,4 @@ check('a', '1')
 check('a+b', '2')
 check('<3>a+<2>b', '5')
 check('(<1/2>a)*', '2')
+check('(<1/3>a+<1/6>b)*(<2>c+<3>d)', '10')
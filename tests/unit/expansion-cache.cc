@@ -0,0 +1,85 @@
+#undef NDEBUG
+
+#include <vcsn/algos/are-isomorphic.hh>
+#include <vcsn/algos/derived-term.hh>
+#include <vcsn/algos/to-expansion.hh>
+#include <vcsn/core/rat/expressionset.hh>
+#include <vcsn/ctx/lal_char_z.hh>
+#include <vcsn/misc/lru-cache.hh>
+
+// Include this one last, as it defines a macro `V`, which is used as
+// a template parameter in boost/unordered/detail/allocate.hpp.
+#include "tests/unit/test.hh"
+
+static size_t
+check_lru_cache()
+{
+  size_t nerrs = 0;
+  auto c = vcsn::lru_cache<int, std::string>{2};
+  ASSERT_EQ(c.find(1) == nullptr, true);
+  c.emplace(1, "one");
+  c.emplace(2, "two");
+  ASSERT_EQ(*c.find(1), "one");
+  // 2 is the least recently used, it is evicted.
+  c.emplace(3, "three");
+  ASSERT_EQ(c.size(), 2U);
+  ASSERT_EQ(c.find(2) == nullptr, true);
+  ASSERT_EQ(*c.find(1), "one");
+  ASSERT_EQ(*c.find(3), "three");
+  ASSERT_EQ(c.hits(), 3U);
+  ASSERT_EQ(c.misses(), 2U);
+  c.clear();
+  ASSERT_EQ(c.size(), 0U);
+  ASSERT_EQ(c.find(1) == nullptr, true);
+  return nerrs;
+}
+
+static size_t
+check_expansion_cache()
+{
+  size_t nerrs = 0;
+  using ctx_t = vcsn::ctx::lal_char_z;
+  using rs_t = vcsn::expressionset<ctx_t>;
+  auto ctx = ctx_t{{'a', 'b'}};
+  auto rs = rs_t{ctx, vcsn::rat::identities::linear};
+  auto xs = vcsn::rat::expansionset<rs_t>{rs};
+  auto cache = std::make_shared<vcsn::rat::expansion_cache<rs_t>>(100);
+
+  auto e = conv(rs, "(a+<2>b)*b(a+<2>b){3} & (a+<2>b)*a(a+<2>b){2}");
+  ASSERT_EQ(to_string(xs, vcsn::to_expansion(rs, e)),
+            to_string(xs, vcsn::to_expansion(rs, e, cache)));
+  ASSERT_EQ(cache->misses(), 1U);
+  ASSERT_EQ(to_string(xs, vcsn::to_expansion(rs, e)),
+            to_string(xs, vcsn::to_expansion(rs, e, cache)));
+  ASSERT_EQ(cache->hits(), 1U);
+
+  // The derived-term automaton reuses the expansion of e, and
+  // computes the ones of the other derived terms.
+  auto a1 = vcsn::derived_term(rs, e, "expansion", cache);
+  ASSERT_EQ(cache->hits(), 2U);
+  ASSERT_EQ(cache->size(), a1->num_states());
+
+  // Build it again: all the expansions are reused.
+  auto misses = cache->misses();
+  auto a2 = vcsn::derived_term(rs, e, "expansion", cache);
+  ASSERT_EQ(cache->misses(), misses);
+  ASSERT_EQ(cache->hits(), 2U + a1->num_states());
+  ASSERT_EQ(vcsn::are_isomorphic(a1, a2), true);
+  ASSERT_EQ(vcsn::are_isomorphic(vcsn::derived_term(rs, e, "expansion"), a2),
+            true);
+
+  // Bounded size.
+  auto small = std::make_shared<vcsn::rat::expansion_cache<rs_t>>(2);
+  auto a3 = vcsn::derived_term(rs, e, "expansion", small);
+  ASSERT_EQ(small->size(), 2U);
+  ASSERT_EQ(vcsn::are_isomorphic(a1, a3), true);
+  return nerrs;
+}
+
+int main()
+{
+  size_t nerrs = 0;
+  nerrs += check_lru_cache();
+  nerrs += check_expansion_cache();
+  return !!nerrs;
+}
@@ -0,0 +1,121 @@
+#undef NDEBUG
+
+#include <map>
+#include <random>
+#include <sstream>
+
+#include <vcsn/algos/are-isomorphic.hh>
+#include <vcsn/algos/dawg.hh>
+#include <vcsn/algos/lexicon.hh>
+#include <vcsn/algos/trie.hh>
+#include <vcsn/ctx/lal_char_b.hh>
+#include <vcsn/weightset/zmin.hh>
+
+// Include this one last, as it defines a macro `V`, which is used as
+// a template parameter in boost/unordered/detail/allocate.hpp.
+#include "tests/unit/test.hh"
+
+/// The minimal automaton of a series given as sorted monomials.
+template <typename Ctx>
+static auto
+dawg_of(const Ctx& ctx, const std::string& s)
+{
+  std::istringstream is{s};
+  return vcsn::dawg(vcsn::detail::make_word_polynomialset(ctx), is);
+}
+
+static size_t
+check_boolean()
+{
+  size_t nerrs = 0;
+  using ctx_t = vcsn::ctx::lal_char_b;
+  auto ctx = ctx_t{{'a', 'b', 'c'}};
+  auto lex = vcsn::make_lexicon(ctx);
+  for (auto w: {"cab", "ab", "b", "abc", "cb", "bc"})
+    lex.add_word(w);
+  ASSERT_EQ(vcsn::are_isomorphic(lex.automaton(),
+                                 dawg_of(ctx, "ab\nabc\nb\nbc\ncab\ncb\n")),
+            true);
+  ASSERT_EQ(lex.weight("cab"), true);
+  ASSERT_EQ(lex.weight("ca"), false);
+
+  ASSERT_EQ(lex.remove_word("abc"), true);
+  ASSERT_EQ(lex.remove_word("abc"), false);
+  ASSERT_EQ(lex.remove_word("ba"), false);
+  ASSERT_EQ(lex.weight("abc"), false);
+  ASSERT_EQ(vcsn::are_isomorphic(lex.automaton(),
+                                 dawg_of(ctx, "ab\nb\nbc\ncab\ncb\n")),
+            true);
+
+  // Back to the empty language: only the initial state remains.
+  for (auto w: {"cab", "ab", "b", "cb", "bc"})
+    ASSERT_EQ(lex.remove_word(w), true);
+  ASSERT_EQ(lex.automaton()->num_states(), 1U);
+  ASSERT_EQ(lex.automaton()->num_transitions(), 0U);
+
+  // From a trie: minimized.
+  auto ps = vcsn::detail::make_word_polynomialset(ctx);
+  auto trie = vcsn::trie(ps, vcsn::conv(ps, "ab+b+cab+cb"));
+  auto lex2 = vcsn::lexicon<ctx_t>{trie};
+  ASSERT_EQ(vcsn::are_isomorphic(lex2.automaton(),
+                                 dawg_of(ctx, "ab\nb\ncab\ncb\n")),
+            true);
+  return nerrs;
+}
+
+static size_t
+check_zmin()
+{
+  size_t nerrs = 0;
+  using ctx_t = vcsn::context<vcsn::ctx::lal_char, vcsn::zmin>;
+  auto ctx = ctx_t{{'a', 'b'}};
+  auto lex = vcsn::make_lexicon(ctx);
+  lex.add_word("ab", 3);
+  lex.add_word("b", 3);
+  ASSERT_EQ(lex.automaton()->num_states(), 3U);
+  // Adding keeps the smallest cost.
+  lex.add_word("ab", 1);
+  lex.add_word("b", 5);
+  ASSERT_EQ(lex.weight("ab"), 1);
+  ASSERT_EQ(lex.weight("b"), 3);
+  ASSERT_EQ(lex.automaton()->num_states(), 4U);
+  ASSERT_EQ(vcsn::are_isomorphic(lex.automaton(),
+                                 dawg_of(ctx, "<1>ab\n<3>b\n")),
+            true);
+
+  // Random updates, checked against the dawg of the lexicon.
+  auto gen = std::mt19937{};
+  auto dist = std::uniform_int_distribution<>(0, 5);
+  auto ref = std::map<std::string, int>{{"ab", 1}, {"b", 3}};
+  for (int i = 0; i < 200; ++i)
+    {
+      auto w = std::string{};
+      for (int n = dist(gen); n; --n)
+        w += "ab"[dist(gen) % 2];
+      if (dist(gen) < 2)
+        {
+          ASSERT_EQ(lex.remove_word(w), bool(ref.erase(w)));
+        }
+      else
+        {
+          auto cost = dist(gen);
+          lex.add_word(w, cost);
+          auto j = ref.emplace(w, cost).first;
+          j->second = std::min(j->second, cost);
+        }
+    }
+  auto s = std::string{};
+  for (const auto& m: ref)
+    s += "<" + std::to_string(m.second) + ">"
+      + (m.first.empty() ? "\\e" : m.first) + "\n";
+  ASSERT_EQ(vcsn::are_isomorphic(lex.automaton(), dawg_of(ctx, s)), true);
+  return nerrs;
+}
+
+int main()
+{
+  size_t nerrs = 0;
+  nerrs += check_boolean();
+  nerrs += check_zmin();
+  return !!nerrs;
+}
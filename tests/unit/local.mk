@@ -20,7 +20,9 @@ EXTRA_PROGRAMS +=                               \
   %D%/cross                                     \
   %D%/distance                                  \
   %D%/dyn                                       \
+  %D%/expansion-cache                           \
   %D%/label                                     \
+  %D%/lexicon                                   \
   %D%/polynomialset                             \
   %D%/proper                                    \
   %D%/transpose                                 \
@@ -38,7 +40,9 @@ noinst_HEADERS = %D%/test.hh %D%/weight.hh
 %C%_concat_LDADD         = $(unit_ldadd)
 %C%_distance_LDADD       = $(unit_ldadd)
 %C%_dyn_LDADD            = $(unit_ldadd)
+%C%_expansion_cache_LDADD = $(unit_ldadd)
 %C%_label_LDADD          = $(unit_ldadd)
+%C%_lexicon_LDADD        = $(unit_ldadd)
 %C%_polynomialset_LDADD  = $(unit_ldadd)
 %C%_proper_LDADD         = $(unit_ldadd)
 %C%_transpose_LDADD      = $(unit_ldadd)
@@ -51,8 +55,10 @@ noinst_HEADERS = %D%/test.hh %D%/weight.hh
   %D%/concat.chk                                \
   %D%/cross.chk                                 \
   %D%/dyn.chk                                   \
+  %D%/expansion-cache.chk                       \
   %D%/ipython.chk                               \
   %D%/label.chk                                 \
+  %D%/lexicon.chk                               \
   %D%/polynomialset.chk                         \
   %D%/proper.chk                                \
   %D%/pylint.chk                                \
@@ -86,8 +92,10 @@ EXTRA_DIST +=                                   \
 %D%/cross.log:          %D%/cross
 %D%/distance.log:       %D%/distance
 %D%/dyn.log:            %D%/dyn
+%D%/expansion-cache.log: %D%/expansion-cache
 %D%/ipython.log:        $(vcsn_python)
 %D%/label.log:          %D%/label
+%D%/lexicon.log:        %D%/lexicon
 %D%/polynomialset.log:  %D%/polynomialset
 %D%/proper.log:         %D%/proper
 %D%/pylint.log:         $(vcsn_python) $(vcsn_python_pylint)
@@ -5,8 +5,10 @@
 #include <vcsn/weightset/log.hh>
 #include <vcsn/weightset/r.hh>
 #include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/qh.hh>
 #include <vcsn/weightset/nmin.hh>
 #include <vcsn/weightset/rmin.hh>
+#include <vcsn/weightset/zh.hh>
 #include <vcsn/weightset/zmin.hh>
 
 #include "tests/unit/weight.hh"
@@ -33,6 +35,9 @@ bool check_bool(const WeightSet& ws, bool one_plus_one)
   // add: "or" or "xor".
   ASSERT_VS_EQ(ws, ws.add(1, 1), one_plus_one);
 
+  // add_n, mul_n, axpy.
+  nerrs += check_batched(ws, {0, 1});
+
   return nerrs;
 }
 
@@ -168,6 +173,139 @@ static size_t check_q()
   return nerrs;
 }
 
+static size_t check_zh()
+{
+  size_t nerrs = 0;
+  vcsn::zh ws;
+
+  nerrs += check_common(ws);
+
+  std::string max = std::to_string(std::numeric_limits<long>::max());
+  std::string min = std::to_string(std::numeric_limits<long>::min());
+
+  // conv.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, conv(ws, In)), Out)
+
+  CHECK("-42", "-42");
+  CHECK("+42", "42");
+  CHECK(max, max);
+  CHECK(min, min);
+  CHECK("123456789012345678901234567890", "123456789012345678901234567890");
+#undef CHECK
+
+  // Overflows are promoted to GMP, and results that fit are
+  // demoted.
+#define CHECK(Op, Lhs, Rhs, Out)                                        \
+  ASSERT_EQ(to_string(ws, ws.Op(conv(ws, Lhs), conv(ws, Rhs))), Out)
+
+  CHECK(add, max, "1", "9223372036854775808");
+  CHECK(add, min, "-1", "-9223372036854775809");
+  CHECK(sub, min, "1", "-9223372036854775809");
+  CHECK(mul, max, max, "85070591730234615847396907784232501249");
+  CHECK(sub, "9223372036854775808", "1", max);
+  CHECK(rdivide, "85070591730234615847396907784232501249", max, max);
+  CHECK(lgcd, "36893488147419103232", "-12", "4");
+#undef CHECK
+
+  ASSERT_VS_EQ(ws, ws.add(conv(ws, "9223372036854775808"), conv(ws, "-1")),
+               std::numeric_limits<long>::max());
+  ASSERT_EQ(ws.less(conv(ws, min), conv(ws, "-" + max)), true);
+  ASSERT_EQ(ws.less(conv(ws, "-" + max), conv(ws, min)), false);
+  ASSERT_EQ(ws.equal(conv(ws, min),
+                     ws.sub(conv(ws, "-" + max), ws.one())), true);
+
+  // add_n, mul_n, axpy.
+  nerrs += check_batched(ws, {0, 1, -3, conv(ws, max)});
+
+  return nerrs;
+}
+
+static size_t check_qh()
+{
+  size_t nerrs = 0;
+  vcsn::qh ws;
+
+  nerrs += check_common(ws);
+
+  std::string max = std::to_string(std::numeric_limits<long>::max());
+
+  // conv.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, conv(ws, In)), Out)
+
+  CHECK("-1/1",  "-1");
+  CHECK("-3/2",  "-3/2");
+  CHECK("0/1",   "0");
+  CHECK("-42/2", "-21");
+  CHECK("1/-2",  "-1/2");
+  CHECK("-3/-6", "1/2");
+  CHECK("123456789012345678901234567890/10", "12345678901234567890123456789");
+#undef CHECK
+
+#define CHECK(Op, Lhs, Rhs, Out)                                        \
+  ASSERT_EQ(to_string(ws, ws.Op(conv(ws, Lhs), conv(ws, Rhs))), Out)
+
+  // As in q.
+  CHECK(add, "1/3", "1/6", "1/2");
+  CHECK(add, "168/9", "14/13", "770/39");
+  CHECK(mul, "-3/2", "2/3", "-1");
+  CHECK(mul, "800000/2", "1/2", "200000");
+  CHECK(rdivide, "3/4", "-3/2", "-1/2");
+
+  // Overflows are promoted to GMP, and results that fit are
+  // demoted.
+  CHECK(mul, "1/" + max, max, "1");
+  CHECK(mul, "1/" + max, "1/" + max,
+        "1/85070591730234615847396907784232501249");
+  CHECK(add, max, max, "18446744073709551614");
+  CHECK(sub, "18446744073709551614", max, max);
+  CHECK(rdivide, "1", "1/" + max, max);
+#undef CHECK
+
+  // star.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, ws.star(conv(ws, In))), Out)
+
+  CHECK("1/2", "2");
+  CHECK("-1/2", "2/3");
+  CHECK("-9223372036854775806/" + max,
+        max + "/18446744073709551613");
+#undef CHECK
+
+  // equal, less.
+  ASSERT_EQ(ws.equal(conv(ws, "8/16"), conv(ws, "1/2")), true);
+  ASSERT_EQ(ws.equal(conv(ws, "1/2"), conv(ws, "1/3")), false);
+  ASSERT_EQ(ws.less(conv(ws, "1/3"), conv(ws, "1/2")), true);
+  ASSERT_EQ(ws.less(conv(ws, "-1/" + max), conv(ws, "1/" + max)), true);
+  ASSERT_EQ(ws.less(conv(ws, max + "/2"), conv(ws, "1/" + max)), false);
+
+  // conv from q.
+  auto qs = vcsn::q{};
+  ASSERT_EQ(to_string(ws, ws.conv(qs, qs.value(-4, 6))), "-2/3");
+
+#define CHECK(Str, Fails)                       \
+  try                                           \
+    {                                           \
+      fails = false;                            \
+      conv(ws, Str);                            \
+    }                                           \
+  catch (const std::exception&)                 \
+    {                                           \
+      fails = true;                             \
+    }                                           \
+  ASSERT_EQ(fails, Fails)
+
+  bool fails;
+  CHECK("1/0",   true);
+  CHECK("abc",   true);
+  CHECK("1/abc", true);
+  CHECK("1/-2",  false);
+#undef CHECK
+
+  return nerrs;
+}
+
 static size_t check_r()
 {
   size_t nerrs = 0;
@@ -268,6 +406,11 @@ static size_t check_tropical_min()
   CHECK(0, 1, false);
 #undef CHECK
 
+  // add_n, mul_n, axpy.
+  nerrs += check_batched(ws, {ws.zero(), ws.one(), 23, 42});
+  if (is_signed)
+    nerrs += check_batched(ws, {ws.zero(), ws.rdivide(ws.one(), 12), 42});
+
   return nerrs;
 }
 
@@ -322,6 +465,9 @@ static size_t check_log()
   CHECK(0, 1, false);
 #undef CHECK
 
+  // add_n, mul_n, axpy.
+  nerrs += check_batched(ws, {ws.zero(), ws.one(), 23, 42, -12, 0.5});
+
   return nerrs;
 }
 
@@ -336,5 +482,7 @@ int main()
   nerrs += check_tropical_min<vcsn::rmin>();
   nerrs += check_r();
   nerrs += check_q();
+  nerrs += check_qh();
+  nerrs += check_zh();
   return !!nerrs;
 }
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "tests/unit/test.hh"
 
 /// Check axiomatic laws of a weightset (semiring).
@@ -37,3 +39,42 @@ bool check_common(const WeightSet& ws)
 
   return nerrs;
 }
+
+/// Check that the batched kernels (add_n, mul_n, axpy) agree with
+/// add and mul on all the pairs of \a vs.
+template <typename WeightSet>
+bool check_batched(const WeightSet& ws,
+                   const std::vector<typename WeightSet::value_t>& vs)
+{
+  size_t nerrs = 0;
+  using value_t = typename WeightSet::value_t;
+  auto ls = std::vector<value_t>{};
+  auto rs = std::vector<value_t>{};
+  for (const auto& l: vs)
+    for (const auto& r: vs)
+      {
+        ls.emplace_back(l);
+        rs.emplace_back(r);
+      }
+  const auto n = ls.size();
+
+  auto res = ls;
+  ws.add_n(begin(res), begin(rs), n);
+  for (size_t i = 0; i < n; ++i)
+    ASSERT_VS_EQ(ws, res[i], ws.add(ls[i], rs[i]));
+
+  res = ls;
+  ws.mul_n(begin(res), begin(rs), n);
+  for (size_t i = 0; i < n; ++i)
+    ASSERT_VS_EQ(ws, res[i], ws.mul(ls[i], rs[i]));
+
+  for (const auto& a: vs)
+    {
+      res = ls;
+      ws.axpy(begin(res), a, begin(rs), n);
+      for (size_t i = 0; i < n; ++i)
+        ASSERT_VS_EQ(ws, res[i], ws.add(ls[i], ws.mul(a, rs[i])));
+    }
+
+  return nerrs;
+}
@@ -167,11 +167,32 @@ namespace vcsn
     return num_useful_states(a) == a->num_states();
   }
 
-  /// Whether all no state is useful.
+  /// Whether no state is useful, i.e., post() is not accessible.
+  ///
+  /// Stops as soon as post() is reached: on lazy automata, only the
+  /// states needed are computed.
   template <Automaton Aut>
   bool is_useless(const Aut& a)
   {
-    return num_useful_states(a) == 0;
+    using state_t = state_t_of<Aut>;
+
+    auto seen = states_t<Aut>{a->pre()};
+    auto todo = std::queue<state_t>{};
+    todo.emplace(a->pre());
+    while (!todo.empty())
+      {
+        const state_t src = todo.front();
+        todo.pop();
+        for (auto tr : all_out(a, src))
+          {
+            state_t dst = a->dst_of(tr);
+            if (dst == a->post())
+              return false;
+            if (seen.emplace(dst).second)
+              todo.emplace(dst);
+          }
+      }
+    return true;
   }
 
   /// Whether all its states are accessible.
@@ -13,6 +13,7 @@
 #include <vcsn/algos/add.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/value.hh>
+#include <vcsn/misc/static-if.hh>
 
 namespace vcsn
 {
@@ -21,6 +22,18 @@ namespace vcsn
   | are_equivalent(automaton, automaton).  |
   `---------------------------------------*/
 
+  namespace detail
+  {
+    /// Whether difference can complete \a Rhs with an implicit sink,
+    /// and look up the labels of \a Lhs in it.  \a Rhs must be
+    /// Boolean: the completed view does not carry its weights.
+    template <Automaton Lhs, Automaton Rhs>
+    using is_completable
+      = bool_constant<labelset_t_of<Rhs>::is_free()
+                      && std::is_same<weightset_t_of<Rhs>, b>::value
+                      && std::is_same<label_t_of<Lhs>, label_t_of<Rhs>>::value>;
+  }
+
   /// Check equivalence between Boolean automata on a free labelset.
   template <Automaton Aut1, Automaton Aut2>
   auto
@@ -31,8 +44,23 @@ namespace vcsn
   {
     const auto& l = realtime(a1);
     const auto& r = realtime(a2);
-    return (is_useless(difference(l, r))
-            && is_useless(difference(r, l)));
+    using lhs_t = std::decay_t<decltype(l)>;
+    using rhs_t = std::decay_t<decltype(r)>;
+    // When possible, compute the differences on the fly, and stop at
+    // the first word accepted by one of them.
+    return detail::static_if<detail::is_completable<lhs_t, rhs_t>{}
+                             && detail::is_completable<rhs_t, lhs_t>{}>
+      ([](const auto& l, const auto& r)
+       {
+         return (is_useless(difference_lazy(l, r))
+                 && is_useless(difference_lazy(r, l)));
+       },
+       [](const auto& l, const auto& r)
+       {
+         return (is_useless(difference(l, r))
+                 && is_useless(difference(r, l)));
+       })
+      (l, r);
   }
 
 
@@ -52,7 +80,9 @@ namespace vcsn
     auto d = add(l,
                  lweight(ws2.sub(ws2.zero(), ws2.one()),
                          r));
-    return is_empty(reduce(d));
+    // Reduce transposed, as reduce() starts with.
+    auto t = transpose(d);
+    return detail::left_reductioner<decltype(t)>{t}.is_zero_series();
   }
 
 
@@ -117,17 +147,52 @@ namespace vcsn
   `-----------------------------------*/
 
   /// An automaton that computes weights of \a lhs, but not by \a rhs.
+  ///
+  /// When possible (see detail::is_completable), \a rhs is completed
+  /// with an implicit sink, instead of one transition per missing
+  /// letter, which is prohibitive on large alphabets.
   template <Automaton Lhs, Automaton Rhs>
   fresh_automaton_t_of<Lhs>
   difference(const Lhs& lhs, const Rhs& rhs)
   {
-    // Meet complement()'s requirements.
-    auto r = strip(rhs);
-    if (!is_deterministic(r))
-      r = complete(strip(determinize(r)));
-    else if (!is_complete(r))
-      r = complete(r);
-    return strip(conjunction(lhs, complement(r)));
+    return detail::static_if<detail::is_completable<Lhs, Rhs>{}>
+      ([](const auto& lhs, const auto& rhs) -> fresh_automaton_t_of<Lhs>
+       {
+         auto r = strip(rhs);
+         if (!is_deterministic(r))
+           r = strip(determinize(r));
+         return conjunction(lhs,
+                            complement(detail::make_completed_automaton(r)));
+       },
+       [](const auto& lhs, const auto& rhs) -> fresh_automaton_t_of<Lhs>
+       {
+         // Meet complement()'s requirements.
+         auto r = strip(rhs);
+         if (!is_deterministic(r))
+           r = complete(strip(determinize(r)));
+         else if (!is_complete(r))
+           r = complete(r);
+         return strip(conjunction(lhs, complement(r)));
+       })
+      (lhs, rhs);
+  }
+
+  /// An automaton that computes weights of \a lhs, but not by \a rhs,
+  /// on-the-fly.
+  ///
+  /// \a rhs is determinized lazily, and completed with an implicit
+  /// sink: only the subsets reachable in the product with \a lhs are
+  /// computed, and only when they are needed.
+  template <Automaton Lhs, Automaton Rhs>
+  auto
+  difference_lazy(const Lhs& lhs, const Rhs& rhs)
+  {
+    static_assert(detail::is_completable<Lhs, Rhs>{},
+                  "difference: lazy: requires a free Boolean rhs,"
+                  " with the same labels as lhs");
+    auto r = determinize(strip(rhs), auto_tag{}, std::true_type{});
+    auto c = detail::completed_automaton<decltype(r)>{r};
+    return conjunction_lazy(lhs, complement(c));
   }
 
   namespace dyn
@@ -135,13 +200,29 @@ namespace vcsn
     namespace detail
     {
       /// Bridge.
-      template <Automaton Lhs, Automaton Rhs>
+      template <Automaton Lhs, Automaton Rhs, typename Bool>
       automaton
-      difference(const automaton& lhs, const automaton& rhs)
+      difference(const automaton& lhs, const automaton& rhs, bool lazy)
       {
         const auto& l = lhs->as<Lhs>();
         const auto& r = rhs->as<Rhs>();
-        return ::vcsn::difference(l, r);
+        return vcsn::detail::static_if
+          <vcsn::detail::is_completable<Lhs, Rhs>{}>
+          ([lazy](const auto& l, const auto& r) -> automaton
+           {
+             if (lazy)
+               return ::vcsn::difference_lazy(l, r);
+             else
+               return ::vcsn::difference(l, r);
+           },
+           [lazy](const auto& l, const auto& r) -> automaton
+           {
+             require(!lazy,
+                     "difference: lazy: requires a free Boolean rhs,"
+                     " with the same labels as lhs");
+             return ::vcsn::difference(l, r);
+           })
+          (l, r);
       }
     }
   }
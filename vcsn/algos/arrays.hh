@@ -0,0 +1,256 @@
+#pragma once
+
+#include <algorithm> // std::max
+#include <cmath> // std::ldexp
+#include <limits>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include <vcsn/core/automaton.hh> // states_size
+#include <vcsn/core/mutable-automaton.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/automaton-arrays.hh>
+#include <vcsn/dyn/context.hh>
+#include <vcsn/misc/functional.hh> // vcsn::less
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/stream.hh> // conv
+#include <vcsn/misc/to-string.hh>
+#include <vcsn/misc/type_traits.hh> // void_t
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*-----------------.
+    | double_weight.   |
+    `-----------------*/
+
+    /// Conversion of weights from and to double.  Not supported by
+    /// default.
+    template <typename WeightSet, typename = void>
+    struct double_weight
+    {
+      using weight_t = typename WeightSet::value_t;
+
+      static double to(const WeightSet& ws, const weight_t&)
+      {
+        raise(ws, ": weights are not numbers");
+      }
+
+      static weight_t from(const WeightSet& ws, double)
+      {
+        raise(ws, ": weights are not numbers");
+      }
+    };
+
+    /// Weightsets of native numbers (b, z, r, zmin, etc.).
+    template <typename WeightSet>
+    struct double_weight<WeightSet,
+                         std::enable_if_t<std::is_arithmetic<
+                           typename WeightSet::value_t>{}>>
+    {
+      using weight_t = typename WeightSet::value_t;
+
+      static double to(const WeightSet&, weight_t w)
+      {
+        return w;
+      }
+
+      static weight_t from(const WeightSet& ws, double d)
+      {
+        auto res = weight_t(d);
+        VCSN_REQUIRE(double(res) == d,
+                     ws, ": invalid weight: ", d);
+        return res;
+      }
+    };
+
+    /// Rationals (q): the double must be exactly representable.
+    template <typename WeightSet>
+    struct double_weight<WeightSet,
+                         void_t<decltype(std::declval<typename
+                                         WeightSet::value_t>().den)>>
+    {
+      using weight_t = typename WeightSet::value_t;
+
+      static double to(const WeightSet&, const weight_t& w)
+      {
+        return double(w.num) / w.den;
+      }
+
+      static weight_t from(const WeightSet& ws, double d)
+      {
+        // Doubles are dyadic: look for the smallest suitable power
+        // of two as denominator.
+        for (int e = 0; e < 31; ++e)
+          {
+            auto n = std::ldexp(d, e);
+            if (n == std::trunc(n))
+              {
+                VCSN_REQUIRE(std::abs(n) <= std::numeric_limits<int>::max(),
+                             ws, ": invalid weight: ", d);
+                return ws.value(int(n), 1U << e);
+              }
+          }
+        raise(ws, ": invalid weight: ", d);
+      }
+    };
+  }
+
+  /*--------------.
+  | to_arrays.    |
+  `--------------*/
+
+  /// The structure of \a aut as flat arrays.
+  ///
+  /// Labels are numbered in the order of the labelset.  Requires
+  /// weights that are numbers.
+  template <Automaton Aut>
+  dyn::automaton_arrays
+  to_arrays(const Aut& aut)
+  {
+    using labelset_t = labelset_t_of<Aut>;
+    using label_t = label_t_of<Aut>;
+    using weightset_t = weightset_t_of<Aut>;
+    using conv_t = detail::double_weight<weightset_t>;
+    const auto& ls = *aut->labelset();
+    const auto& ws = *aut->weightset();
+
+    auto res = dyn::automaton_arrays{};
+
+    // State -> state number.
+    auto number = std::vector<int32_t>(detail::states_size(aut), -1);
+    for (auto s: aut->states())
+      {
+        number[s] = res.states.size();
+        res.states.emplace_back(s - 2);
+      }
+
+    // The labels, in order.
+    auto labels = std::map<label_t, int32_t, vcsn::less<labelset_t>>{};
+    for (auto t: transitions(aut))
+      labels.emplace(aut->label_of(t), 0);
+    for (auto& l: labels)
+      {
+        l.second = res.label_names.size();
+        res.label_names.emplace_back(to_string(ls, l.first));
+      }
+
+    for (auto t: all_transitions(aut))
+      {
+        auto src = aut->src_of(t);
+        auto dst = aut->dst_of(t);
+        res.sources.emplace_back(src == aut->pre() ? -1 : number[src]);
+        res.destinations.emplace_back(dst == aut->post() ? -1 : number[dst]);
+        res.labels.emplace_back(src == aut->pre() || dst == aut->post()
+                                ? -1
+                                : labels[aut->label_of(t)]);
+        res.weights.emplace_back(conv_t::to(ws, aut->weight_of(t)));
+      }
+    return res;
+  }
+
+  /*----------------.
+  | from_arrays.    |
+  `----------------*/
+
+  /// Build an automaton from flat arrays.
+  ///
+  /// \param ctx     the context of the result
+  /// \param arrays  the structure.  If `states` is empty, the number
+  ///                of states is given by the largest state number.
+  ///                If `weights` is empty, all the weights are one.
+  template <typename Context>
+  mutable_automaton<Context>
+  from_arrays(const Context& ctx, const dyn::automaton_arrays& arrays)
+  {
+    using automaton_t = mutable_automaton<Context>;
+    using weightset_t = weightset_t_of<Context>;
+    using conv_t = detail::double_weight<weightset_t>;
+    const auto& ls = *ctx.labelset();
+    const auto& ws = *ctx.weightset();
+
+    const auto size = arrays.sources.size();
+    require(arrays.destinations.size() == size
+            && arrays.labels.size() == size
+            && (arrays.weights.empty() || arrays.weights.size() == size),
+            "from_arrays: arrays of different sizes");
+
+    auto labels = std::vector<label_t_of<Context>>{};
+    labels.reserve(arrays.label_names.size());
+    for (const auto& l: arrays.label_names)
+      labels.emplace_back(conv(ls, l));
+
+    auto num_states = arrays.states.size();
+    if (num_states == 0)
+      for (size_t i = 0; i < size; ++i)
+        {
+          auto src = arrays.sources[i];
+          auto dst = arrays.destinations[i];
+          VCSN_REQUIRE(-1 <= src && -1 <= dst,
+                       "from_arrays: invalid transition ", i, ": ",
+                       src, " -> ", dst);
+          num_states = std::max({num_states,
+                                 size_t(src + 1), size_t(dst + 1)});
+        }
+
+    auto res = make_mutable_automaton(ctx);
+    auto states = std::vector<state_t_of<automaton_t>>{};
+    states.reserve(num_states);
+    for (size_t i = 0; i < num_states; ++i)
+      states.emplace_back(res->new_state());
+
+    for (size_t i = 0; i < size; ++i)
+      {
+        auto src = arrays.sources[i];
+        auto dst = arrays.destinations[i];
+        auto l = arrays.labels[i];
+        VCSN_REQUIRE(-1 <= src && src < int32_t(num_states)
+                     && -1 <= dst && dst < int32_t(num_states)
+                     && (src != -1 || dst != -1),
+                     "from_arrays: invalid transition ", i, ": ",
+                     src, " -> ", dst);
+        auto w = arrays.weights.empty()
+          ? ws.one()
+          : conv_t::from(ws, arrays.weights[i]);
+        if (src == -1)
+          res->add_initial(states[dst], w);
+        else if (dst == -1)
+          res->add_final(states[src], w);
+        else
+          {
+            VCSN_REQUIRE(0 <= l && l < int32_t(labels.size()),
+                         "from_arrays: invalid label for transition ", i,
+                         ": ", l);
+            res->add_transition(states[src], states[dst], labels[l], w);
+          }
+      }
+    return res;
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut>
+      automaton_arrays
+      to_arrays(const automaton& aut)
+      {
+        const auto& a = aut->as<Aut>();
+        return ::vcsn::to_arrays(a);
+      }
+
+      /// Bridge.
+      template <typename Ctx, typename Arrays>
+      automaton
+      from_arrays(const context& ctx, const automaton_arrays& arrays)
+      {
+        const auto& c = ctx->as<Ctx>();
+        return ::vcsn::from_arrays(c, arrays);
+      }
+    }
+  }
+}
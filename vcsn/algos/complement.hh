@@ -2,6 +2,7 @@
 
 #include <set>
 
+#include <vcsn/algos/complete.hh> // completed_automaton
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/is-complete.hh>
 #include <vcsn/algos/is-deterministic.hh>
@@ -53,6 +54,15 @@ namespace vcsn
     return res;
   }
 
+  /// The complement of a completed automaton: flip its final states,
+  /// including its implicit sink.  Constant time.
+  template <Automaton Aut>
+  detail::completed_automaton<Aut>
+  complement(const detail::completed_automaton<Aut>& aut)
+  {
+    return aut.complement();
+  }
+
   namespace dyn
   {
     namespace detail
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <memory>
+
 #include <vcsn/algos/copy.hh>
+#include <vcsn/algos/is-deterministic.hh>
+#include <vcsn/core/transition-map.hh>
 #include <vcsn/dyn/automaton.hh> // dyn::make_automaton
 #include <vcsn/dyn/fwd.hh>
+#include <vcsn/misc/raise.hh>
 #include <vcsn/misc/unordered_set.hh>
 
 namespace vcsn
@@ -70,6 +75,122 @@ namespace vcsn
     return res;
   }
 
+  namespace detail
+  {
+    /*--------------------------.
+    | completed_automaton<Aut>. |
+    `--------------------------*/
+
+    /// A deterministic automaton, seen as complete: the missing
+    /// transitions lead to an implicit sink state, which is never
+    /// materialized.  On large alphabets (e.g., lal_string),
+    /// complete would add one transition per missing letter and per
+    /// state, while this view costs nothing.
+    ///
+    /// It may also be complemented, in which case its final states,
+    /// including the sink, are flipped.  See complement and
+    /// conjunction.
+    ///
+    /// The automaton may be lazy (e.g., a lazy determinization): its
+    /// states are computed when needed.
+    template <Automaton Aut>
+    class completed_automaton
+    {
+    public:
+      using automaton_t = Aut;
+      using state_t = state_t_of<automaton_t>;
+      using label_t = label_t_of<automaton_t>;
+
+      static_assert(labelset_t_of<automaton_t>::is_free(),
+                    "completed_automaton: requires free labelset");
+
+      /// \pre aut is deterministic.
+      completed_automaton(const automaton_t& aut)
+        : aut_(aut)
+        , map_(std::make_shared<map_t>(aut))
+      {}
+
+      /// The underlying (incomplete) automaton.
+      const automaton_t& strip() const
+      {
+        return aut_;
+      }
+
+      /// The implicit sink state.  Like post(), it has no outgoing
+      /// transitions.
+      state_t sink() const
+      {
+        return aut_->post();
+      }
+
+      /// The initial state, possibly the sink.
+      state_t initial() const
+      {
+        for (auto t: initial_transitions(aut_))
+          return aut_->dst_of(t);
+        return sink();
+      }
+
+      /// The successor of \a s by \a l, possibly the sink.
+      state_t dst(state_t s, const label_t& l) const
+      {
+        if (s != sink())
+          {
+            const auto& ts = (*map_)[s];
+            auto i = ts.find(l);
+            if (i != end(ts))
+              return i->second.dst;
+          }
+        return sink();
+      }
+
+      /// Whether \a s, possibly the sink, is final.
+      bool is_final(state_t s) const
+      {
+        if (s == sink())
+          return complemented_;
+        // Compute s, in case it is lazy.
+        (*map_)[s];
+        return aut_->is_final(s) != complemented_;
+      }
+
+      /// Whether the sink is final.
+      bool is_sink_final() const
+      {
+        return complemented_;
+      }
+
+      /// The same automaton, with the final states flipped.
+      completed_automaton complement() const
+      {
+        auto res = *this;
+        res.complemented_ = !complemented_;
+        return res;
+      }
+
+    private:
+      /// Outgoing transitions, indexed by label.
+      using map_t = transition_map<automaton_t, weightset_t_of<automaton_t>,
+                                   true>;
+      /// The automaton.
+      automaton_t aut_;
+      /// Its transitions, shared by the complements.
+      std::shared_ptr<map_t> map_;
+      /// Whether the final states are flipped.
+      bool complemented_ = false;
+    };
+
+    /// A completed view on \a aut, which must be deterministic.
+    template <Automaton Aut>
+    completed_automaton<Aut>
+    make_completed_automaton(const Aut& aut)
+    {
+      require(is_deterministic(aut),
+              "completed_automaton: requires a deterministic automaton");
+      return {aut};
+    }
+  }
+
   namespace dyn
   {
     namespace detail
@@ -4,6 +4,7 @@
 #include <map>
 #include <utility>
 
+#include <vcsn/algos/complete.hh> // completed_automaton
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/insplit.hh>
 #include <vcsn/algos/is-proper.hh>
@@ -611,6 +612,138 @@ namespace vcsn
     }
 
 
+    /*-----------------------------------------------------------.
+    | completed_product_automaton_impl<Lazy, Aut, Lhs, Rhs>.     |
+    `-----------------------------------------------------------*/
+
+    /// The (accessible part of the) product of an automaton with a
+    /// completed automaton.
+    ///
+    /// Since \a Rhs is deterministic, the states are pairs of
+    /// states, and the weights are those of \a Lhs.  Where \a Rhs has
+    /// no transition, it moves to its implicit sink, which it never
+    /// leaves.  If the sink is not final, such pairs are not built at
+    /// all, otherwise \a Lhs runs alone.  Hence this costs
+    /// O(transitions of the result), even on large alphabets.
+    ///
+    /// When lazy, the states are computed on demand, and so are the
+    /// states of \a Rhs if it is lazy too (e.g., a lazy
+    /// determinization): only the subsets reachable in the product
+    /// are built.
+    template <bool Lazy, Automaton Aut, Automaton Lhs, Automaton Rhs>
+    class completed_product_automaton_impl
+      : public lazy_tuple_automaton<completed_product_automaton_impl<Lazy, Aut,
+                                                                     Lhs, Rhs>,
+                                    false, Lazy, Aut, Lhs, Rhs>
+    {
+      static_assert(std::is_same<label_t_of<Lhs>, label_t_of<Rhs>>::value,
+                    "conjunction: incompatible labels");
+
+      using self_t = completed_product_automaton_impl;
+      using super_t = lazy_tuple_automaton<self_t, false, Lazy, Aut, Lhs, Rhs>;
+
+    public:
+      using state_name_t = typename super_t::state_name_t;
+      using state_t = typename super_t::state_t;
+      using completed_t = completed_automaton<Rhs>;
+
+      static symbol sname()
+      {
+        static symbol res("completed_product_automaton"
+                          + super_t::sname_(std::string{Lazy ? "true" : "false"}));
+        return res;
+      }
+
+      std::ostream& print_set(std::ostream& o, format fmt = {}) const
+      {
+        o << "completed_product_automaton";
+        return aut_->print_set_(o, fmt);
+      }
+
+      completed_product_automaton_impl(Aut aut,
+                                       const Lhs& lhs, const completed_t& rhs)
+        : super_t{aut, lhs, rhs.strip()}
+        , rhs_(rhs)
+      {}
+
+      /// Compute the (accessible part of the) conjunction.
+      void conjunction()
+      {
+        if (!Lazy)
+          {
+            aut_->todo_.emplace_back(aut_->pre_(), aut_->pre());
+            while (!aut_->todo_.empty())
+              {
+                const auto& p = aut_->todo_.front();
+                add_transitions(std::get<1>(p), std::get<0>(p));
+                aut_->todo_.pop_front();
+              }
+          }
+      }
+
+      /// Tell lazy_tuple_automaton how to add the transitions to a state
+      void add_transitions(const state_t src, const state_name_t& psrc)
+      {
+        const auto& ls = *aut_->labelset();
+        const auto r = std::get<1>(psrc);
+        const auto& ts = std::get<0>(transition_maps_)[std::get<0>(psrc)];
+        for (const auto& t: ts)
+          if (!ls.is_special(t.first))
+            // The rhs is free: it does not move on spontaneous
+            // transitions.
+            add_transitions_(src,
+                             ls.is_one(t.first) ? r : rhs_.dst(r, t.first),
+                             t.first, t.second);
+        // Initial or final transitions.
+        auto i = ts.find(ls.special());
+        if (i != end(ts))
+          {
+            if (src == aut_->pre())
+              add_transitions_(src, rhs_.initial(), i->first, i->second);
+            else if (rhs_.is_final(r))
+              this->new_transition(src, aut_->post(), i->first,
+                                   i->second.front().weight());
+          }
+      }
+
+    private:
+      using super_t::aut_;
+      using super_t::state;
+      using super_t::transition_maps_;
+
+      /// Add the transitions from \a src to the pairs of the
+      /// destinations in \a ts and \a r, unless \a r is a dead sink.
+      template <typename Transitions>
+      void add_transitions_(const state_t src, state_t_of<Rhs> r,
+                            const label_t_of<Aut>& l, const Transitions& ts)
+      {
+        if (r != rhs_.sink() || rhs_.is_sink_final())
+          for (const auto& t: ts)
+            // These are always new transitions: the source state is
+            // visited for the first time, and rhs is deterministic.
+            this->new_transition(src, state(t.dst, r), l, t.weight());
+      }
+
+      /// The right-hand side automaton, completed.
+      completed_t rhs_;
+    };
+
+    /// A completed product automaton as a shared pointer.
+    template <bool Lazy, Automaton Aut, Automaton Lhs, Automaton Rhs>
+    using completed_product_automaton
+      = std::shared_ptr<completed_product_automaton_impl<Lazy, Aut, Lhs, Rhs>>;
+
+    template <bool Lazy, Automaton Aut, Automaton Lhs, Automaton Rhs>
+    auto
+    make_completed_product_automaton(Aut aut, const Lhs& lhs,
+                                     const completed_automaton<Rhs>& rhs)
+      -> completed_product_automaton<Lazy, Aut, Lhs, Rhs>
+    {
+      using res_t = completed_product_automaton<Lazy, Aut, Lhs, Rhs>;
+      return make_shared_ptr<res_t>(aut, lhs, rhs);
+    }
+
+
     /*-----------------------------.
     | conjunction(automaton...).   |
     `-----------------------------*/
@@ -636,8 +769,34 @@ namespace vcsn
       res->conjunction();
       return res;
     }
+
+    /// Build the (accessible part of the) conjunction with a
+    /// completed automaton.
+    template <Automaton Lhs, Automaton Rhs>
+    fresh_automaton_t_of<Lhs>
+    conjunction(const Lhs& lhs, const completed_automaton<Rhs>& rhs)
+    {
+      auto res = make_completed_product_automaton<false>
+        (make_fresh_automaton(lhs), lhs, rhs);
+      res->conjunction();
+      // Strip the product, and the tuple automaton.
+      return res->strip()->strip();
+    }
+
+    /// Build the (accessible part of the) conjunction with a
+    /// completed automaton, on-the-fly.
+    template <Automaton Lhs, Automaton Rhs>
+    auto
+    conjunction_lazy(const Lhs& lhs, const completed_automaton<Rhs>& rhs)
+    {
+      auto res = make_completed_product_automaton<true>
+        (make_fresh_automaton(lhs), lhs, rhs);
+      res->conjunction();
+      return res;
+    }
   }
 
+  using detail::completed_product_automaton;
   using detail::conjunction;
   using detail::conjunction_lazy;
 
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include <vcsn/algos/trie.hh> // quote
+#include <vcsn/core/automaton.hh> // all_out
+#include <vcsn/core/mutable-automaton.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/context.hh>
+#include <vcsn/labelset/labelset.hh> // detail::free_context
+#include <vcsn/labelset/word-polynomialset.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/raise.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /// Build the minimal deterministic automaton of a
+    /// lexicographically sorted list of weighted words, incrementally.
+    ///
+    /// Daciuk et al., "Incremental Construction of Minimal Acyclic
+    /// Finite-State Automata", Computational Linguistics, 2000.
+    ///
+    /// Only the states along the last word added may still change:
+    /// they are kept aside (in path_), and the automaton contains only
+    /// minimal states, indexed in a register by their outgoing
+    /// transitions and final weight.  When a new word leaves this
+    /// path, the pending states below the branching point are
+    /// replaced by an equivalent state from the register, or added to
+    /// the automaton and registered.  Therefore the memory footprint
+    /// is bounded by the size of the result, plus the length of the
+    /// longest word.
+    ///
+    /// As in tries, the weights are on the final transitions.  The
+    /// words must be in lexicographic order: they are compared letter
+    /// by letter, and a word comes before its extensions (e.g., "ab"
+    /// before "abc" and "b").  This is not the shortlex order of
+    /// wordsets.  Repeated words have their weights added.
+    ///
+    /// \tparam  Context  the context of the mutable_automaton to build.
+    ///                   It is typically a letterset, even though we feed
+    ///                   it with words.
+    template <typename Context>
+    class dawg_builder
+    {
+    public:
+      using context_t = Context;
+      using self_t = dawg_builder;
+      /// The type of the result.
+      using automaton_t = mutable_automaton<context_t>;
+      using labelset_t = labelset_t_of<context_t>;
+      using letter_t = letter_t_of<context_t>;
+      using word_t = word_t_of<context_t>;
+      using weightset_t = weightset_t_of<context_t>;
+      using weight_t = weight_t_of<context_t>;
+      using state_t = state_t_of<automaton_t>;
+
+      /// Polynomialset for the input: weighted words.
+      using polynomialset_t = word_polynomialset_t<context_t>;
+      using monomial_t = typename polynomialset_t::monomial_t;
+
+      dawg_builder(const context_t& c)
+        : res_(make_mutable_automaton(c))
+        , register_(1024, hasher{*this}, equal{*this})
+        , path_(1)
+      {}
+
+      /// The register refers to this builder.
+      dawg_builder(const dawg_builder&) = delete;
+
+      /// Add a monomial.
+      /// \param l   the word to add.
+      /// \param w   its associated weight.
+      void add(const word_t& l, const weight_t& w = weightset_t::one())
+      {
+        const auto& ls = *ctx_.labelset();
+        const auto& ws = *ctx_.weightset();
+        word_.clear();
+        for (auto a: ls.letters_of_padded(l, padding_))
+          word_.emplace_back(a);
+
+        // The length of the common prefix with the previous word.
+        auto prefix = size_t{0};
+        while (prefix < prev_.size() && prefix < word_.size()
+               && ls.equal(prev_[prefix], word_[prefix]))
+          ++prefix;
+        VCSN_REQUIRE((prefix == prev_.size()
+                      || (prefix < word_.size()
+                          && ls.less(prev_[prefix], word_[prefix]))),
+                     "dawg: words are not sorted: ",
+                     to_string(make_wordset(ls), l),
+                     " after ",
+                     to_string(make_wordset(ls), last_));
+
+        // The states of the previous word beyond the common prefix
+        // will no longer change.
+        replace_or_register_(prefix);
+        path_.resize(word_.size() + 1);
+        path_.back().final = ws.add(path_.back().final, w);
+        std::swap(prev_, word_);
+        last_ = l;
+      }
+
+      /// Add a monomial.
+      void add(const monomial_t& m)
+      {
+        add(label_of(m), weight_of(m));
+      }
+
+      /// Add all the words (one per line) in this stream.
+      void add_words(std::istream& is)
+      {
+        auto ls = make_wordset(*ctx_.labelset());
+        ls.open(true);
+        std::string buf;
+        while (getline(is, buf))
+          add(conv(ls, quote(buf)));
+      }
+
+      /// Add all the monomials (one per line) in this stream.
+      void add_monomials(std::istream& is)
+      {
+        auto ps = make_word_polynomialset(ctx_);
+        while (auto m = ps.conv_monomial(is))
+          add(*m);
+      }
+
+      /// Add all the monomials in this stream.
+      void add(std::istream& is, const std::string& format)
+      {
+        static const auto map = getarg<void(self_t::*)(std::istream&)>
+          {
+            "dawg format",
+            {
+              {"default",   "monomials"},
+              {"monomials", &self_t::add_monomials},
+              {"words",     &self_t::add_words},
+            }
+          };
+        (this->*(map[format]))(is);
+      }
+
+      /// The minimal automaton of the words added so far.  The
+      /// builder can no longer be used afterwards.
+      automaton_t result()
+      {
+        replace_or_register_(0);
+        // The initial state cannot be equivalent to another state,
+        // no need to look it up.  Keep the result trim, even for an
+        // empty series.
+        if (!is_dead_(path_[0]))
+          res_->set_initial(new_state_(path_[0]));
+        return res_;
+      }
+
+    private:
+      /// A state along the current word, not in the automaton yet.
+      struct pending_t
+      {
+        /// Its final weight.
+        weight_t final = weightset_t::zero();
+        /// Its outgoing transitions, sorted by label.
+        std::vector<std::pair<letter_t, state_t>> out;
+      };
+
+      /// The state that denotes candidate_ in the register.
+      static constexpr state_t pending_state()
+      {
+        return automaton_t::element_type::null_state();
+      }
+
+      /// The outgoing transitions of a state of the automaton, or of
+      /// candidate_, as a sequence of (label, destination, weight),
+      /// the final transition first.
+      template <typename Fun>
+      void for_each_out_(state_t s, Fun f) const
+      {
+        if (s == pending_state())
+          {
+            const auto& ls = *ctx_.labelset();
+            const auto& ws = *ctx_.weightset();
+            if (!ws.is_zero(candidate_->final))
+              f(ls.special(), res_->post(), candidate_->final);
+            for (const auto& t: candidate_->out)
+              f(t.first, t.second, ws.one());
+          }
+        else
+          for (auto t: all_out(res_, s))
+            f(res_->label_of(t), res_->dst_of(t), res_->weight_of(t));
+      }
+
+      /// Hash a state from its outgoing transitions.
+      struct hasher
+      {
+        size_t operator()(state_t s) const
+        {
+          const auto& ls = *b_.ctx_.labelset();
+          const auto& ws = *b_.ctx_.weightset();
+          size_t res = 0;
+          b_.for_each_out_(s,
+                           [&](const auto& l, state_t d, const auto& w)
+                           {
+                             hash_combine_hash(res, ls.hash(l));
+                             hash_combine(res, d);
+                             hash_combine_hash(res, ws.hash(w));
+                           });
+          return res;
+        }
+
+        const dawg_builder& b_;
+      };
+
+      /// Whether two states have the same outgoing transitions.
+      /// Since the transitions are created in order, compare them
+      /// pairwise.
+      struct equal
+      {
+        bool operator()(state_t s1, state_t s2) const
+        {
+          const auto& ls = *b_.ctx_.labelset();
+          const auto& ws = *b_.ctx_.weightset();
+          // s2 is in the automaton.
+          if (s1 == pending_state())
+            std::swap(s1, s2);
+          const auto& ts1 = b_.res_->all_out(s1);
+          auto i = begin(ts1);
+          auto res = true;
+          b_.for_each_out_(s2,
+                           [&](const auto& l, state_t d, const auto& w)
+                           {
+                             res = (res
+                                    && i != end(ts1)
+                                    && ls.equal(b_.res_->label_of(*i), l)
+                                    && b_.res_->dst_of(*i) == d
+                                    && ws.equal(b_.res_->weight_of(*i), w));
+                             if (res)
+                               ++i;
+                           });
+          return res && i == end(ts1);
+        }
+
+        const dawg_builder& b_;
+      };
+
+      /// Whether this pending state is useless (e.g., weights summing
+      /// to zero).
+      bool is_dead_(const pending_t& p) const
+      {
+        return ctx_.weightset()->is_zero(p.final) && p.out.empty();
+      }
+
+      /// Add this pending state to the automaton.
+      state_t new_state_(const pending_t& p)
+      {
+        auto res = res_->new_state();
+        if (!ctx_.weightset()->is_zero(p.final))
+          res_->set_final(res, p.final);
+        for (const auto& t: p.out)
+          res_->new_transition(res, t.second, t.first);
+        return res;
+      }
+
+      /// Freeze the pending states that are beyond \a depth: replace
+      /// each of them by an equivalent registered state, or register
+      /// it.  Deepest first, so that the successors of a state are
+      /// registered before it.
+      void replace_or_register_(size_t depth)
+      {
+        for (auto i = path_.size() - 1; depth < i; --i)
+          {
+            auto& p = path_[i];
+            if (!is_dead_(p))
+              {
+                candidate_ = &p;
+                auto j = register_.find(pending_state());
+                auto s = state_t{};
+                if (j == end(register_))
+                  {
+                    s = new_state_(p);
+                    register_.insert(s);
+                  }
+                else
+                  s = *j;
+                path_[i - 1].out.emplace_back(prev_[i - 1], s);
+              }
+            p.final = ctx_.weightset()->zero();
+            p.out.clear();
+          }
+        prev_.resize(depth);
+      }
+
+      /// The automaton being built.
+      automaton_t res_;
+      /// The context of the automaton: letterized.
+      const context_t& ctx_ = res_->context();
+      /// The minimal states.
+      std::unordered_set<state_t, hasher, equal> register_;
+      /// The pending states along prev_, starting with the initial
+      /// state.
+      std::vector<pending_t> path_;
+      /// The pending state being looked up in the register.
+      const pending_t* candidate_ = nullptr;
+      /// The letters of the previous word.
+      std::vector<letter_t> prev_;
+      /// The letters of the current word.
+      std::vector<letter_t> word_;
+      /// The previous word, for error messages.
+      word_t last_;
+      /// Padding, in case it is needed.
+      typename letterized_t<labelset_t>::value_t padding_
+        = letterized_t<labelset_t>::one();
+    };
+
+  }
+
+  /// Make the minimal deterministic automaton of a finite series
+  /// read from a stream of lexicographically sorted words.
+  ///
+  /// Same as trie followed by minimize, but without building the
+  /// trie.
+  ///
+  /// \param ps      the polynomialset
+  /// \param is      the stream to read
+  /// \param format  the format of the file: "words" or "monomials"
+  template <typename PolynomialSet>
+  mutable_automaton<detail::free_context<context_t_of<PolynomialSet>>>
+  dawg(const PolynomialSet& ps, std::istream& is,
+       const std::string& format = "default")
+  {
+    using context_t = detail::free_context<context_t_of<PolynomialSet>>;
+    detail::dawg_builder<context_t> d{make_free_context(ps.context())};
+    d.add(is, format);
+    return d.result();
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge (dawg).
+      template <typename Context, typename Istream, typename String>
+      automaton
+      dawg_stream(const context& ctx, std::istream& is,
+                  const std::string& format)
+      {
+        const auto& c = ctx->as<Context>();
+        auto ps = make_word_polynomialset(c);
+        return dawg(ps, is, format);
+      }
+    }
+  }
+} // vcsn::
@@ -128,7 +128,8 @@ namespace vcsn
             // of the following line.
             res_
               = ps_.rmul_label(res_,
-                               prod_(std::next(e.begin(), i+1), std::end(e)));
+                               rs_.mul_range(std::next(e.begin(), i+1),
+                                             std::end(e)));
             ps_.add_here(res, ps_.lweight(constant, res_));
             constant = ws_.mul(constant, constant_term(rs_, v));
             if (ws_.is_zero(constant))
@@ -137,23 +138,6 @@ namespace vcsn
         res_ = std::move(res);
       }
 
-      /// Build a product for these expressions.  Pay attention to not
-      /// building products with 0 or 1 expression.
-      ///
-      /// FIXME: Code duplication with to_expansion.
-      expression_t
-      prod_(typename mul_t::iterator begin,
-            typename mul_t::iterator end) const
-      {
-        using expressions_t = typename mul_t::values_t;
-        if (begin == end)
-          return rs_.one();
-        else if (std::next(begin, 1) == end)
-          return *begin;
-        else
-          return std::make_shared<mul_t>(expressions_t{begin, end});
-      }
-
 
       VCSN_RAT_VISIT(conjunction, e)
       {
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <vector>
+
 #include <vcsn/algos/constant-term.hh>
 #include <vcsn/algos/derivation.hh>
+#include <vcsn/algos/positions.hh>
 #include <vcsn/algos/split.hh>
 #include <vcsn/algos/to-expansion.hh>
 #include <vcsn/core/automaton.hh> // all_out
@@ -26,6 +29,7 @@ namespace vcsn
         {
           derivation,
           expansion,
+          positions,
         };
 
       derived_term_algo(algo_t a, bool b, bool d)
@@ -54,6 +58,7 @@ namespace vcsn
               {"expansion,breaking",      dta{expansion,  true,  false}},
               {"expansion,deterministic", dta{expansion,  false, true}},
               {"expansion_breaking",      "expansion,breaking"},
+              {"positions",               dta{positions,  false, false}},
             }
           };
         if (boost::starts_with(algo, "lazy,"))
@@ -137,6 +142,7 @@ namespace vcsn
 
       using context_t = context_t_of<expressionset_t>;
       using weightset_t = weightset_t_of<context_t>;
+      using weight_t = weight_t_of<context_t>;
 
       /// The type of the (strict) automaton we build.
       using automaton_t = expression_automaton<mutable_automaton<context_t>>;
@@ -161,11 +167,20 @@ namespace vcsn
         return rs_.print_set(o, fmt) << '>';
       }
 
+      /// The cache of expansions.
+      using cache_t = rat::expansion_cache<expressionset_t>;
+
+      /// \param rs     the expressionset
+      /// \param algo   how to compute the derived terms
+      /// \param cache  if not null, the expansions to reuse, and where
+      ///               to save the ones computed here.
       derived_term_automaton_impl(const expressionset_t& rs,
-                                  derived_term_algo algo)
+                                  derived_term_algo algo,
+                                  std::shared_ptr<cache_t> cache = nullptr)
         : super_t{make_shared_ptr<automaton_t>(rs)}
         , rs_{rs}
         , algo_{algo}
+        , to_expansion_{rs_, std::move(cache)}
         , members_{rs}
       {}
 
@@ -176,6 +191,8 @@ namespace vcsn
           {
             if (algo_.algo == derived_term_algo::derivation)
               return via_derivation(exp);
+            else if (algo_.algo == derived_term_algo::positions)
+              return via_positions(exp);
             else
               return via_expansion(exp);
           }
@@ -211,6 +228,53 @@ namespace vcsn
         return aut_;
       }
 
+      /// Compute the derived-term automaton via the positions of the
+      /// expression: the derived terms are the continuations of the
+      /// positions, so the expression is traversed once, instead of
+      /// once per state and letter.
+      automaton_t via_positions(const expression_t& exp)
+      {
+        const auto ps = positions(rs_, exp);
+        // The state of each position, once looked up.
+        auto states
+          = std::vector<state_t>(ps.positions.size(), aut_->null_state());
+        // The positions whose state might be incomplete.
+        auto todo = std::vector<unsigned>{};
+        // Complete the state \a s, given its follow set.
+        auto complete = [&](state_t s,
+                            const weight_t& final, const auto& follow)
+          {
+            aut_->set_lazy(s, false);
+            aut_->set_final(s, final);
+            for (const auto& q: follow)
+              {
+                auto& dst = states[q.first];
+                if (dst == aut_->null_state())
+                  {
+                    dst = aut_->state(ps.positions[q.first].continuation);
+                    todo.emplace_back(q.first);
+                  }
+                aut_->add_transition(s, dst, ps.positions[q.first].label,
+                                     q.second);
+              }
+          };
+        aut_->set_initial(exp, ws_.one());
+        complete(aut_->state(exp), ps.constant, ps.first);
+        while (!todo.empty())
+          {
+            auto p = todo.back();
+            todo.pop_back();
+            // Positions with the same continuation have the same
+            // follow set: complete each state once.
+            if (aut_->is_lazy(states[p]))
+              complete(states[p],
+                       ps.positions[p].final, ps.positions[p].follow);
+          }
+        // All the states are complete.
+        aut_->todo_ = {};
+        return aut_;
+      }
+
       //    private:
       /// The expression_automaton we are building.
       using super_t::aut_;
@@ -303,7 +367,7 @@ namespace vcsn
       expansionset_t es_ = {rs_};
       /// Used for expansions.
       using to_expansion_t = rat::to_expansion_visitor<expressionset_t>;
-      to_expansion_t to_expansion_ = {rs_};
+      to_expansion_t to_expansion_;
       /// Possibly the generators.
       derived_term_automaton_members<expressionset_t> members_ = {rs_};
     };
@@ -317,41 +381,48 @@ namespace vcsn
   template <typename ExpSet>
   auto
   make_derived_term_automaton(const ExpSet& rs,
-                              const detail::derived_term_algo& algo)
+                              const detail::derived_term_algo& algo,
+                              std::shared_ptr<rat::expansion_cache<ExpSet>>
+                                cache = nullptr)
     -> derived_term_automaton<ExpSet>
   {
     using res_t = derived_term_automaton<ExpSet>;
-    return make_shared_ptr<res_t>(rs, algo);
+    return make_shared_ptr<res_t>(rs, algo, std::move(cache));
   }
 
   /// The derived-term automaton, for letterized labelsets.
   ///
-  /// \param rs    the expressionset
-  /// \param r     the expression
-  /// \param algo  the algo to run: "auto", "derivation", or "expansion".
+  /// \param rs     the expressionset
+  /// \param r      the expression
+  /// \param algo   the algo to run: "auto", "derivation", "expansion",
+  ///               or "positions".
+  /// \param cache  if not null, the expansions to reuse and complete.
   template <typename ExpSet>
   std::enable_if_t<labelset_t_of<ExpSet>::is_letterized(),
     expression_automaton<mutable_automaton<typename ExpSet::context_t>>>
   derived_term(const ExpSet& rs,
                const typename ExpSet::value_t& r,
-               const std::string& algo = "auto")
+               const std::string& algo = "auto",
+               std::shared_ptr<rat::expansion_cache<ExpSet>> cache = nullptr)
   {
     auto a = detail::derived_term_algo(algo);
-    auto dt = make_derived_term_automaton(rs, a);
+    auto dt = make_derived_term_automaton(rs, a, std::move(cache));
     return dt->operator()(r);
   }
 
   /// The derived-term automaton, for non letterized labelsets.
   ///
-  /// \param rs    the expressionset
-  /// \param r     the expression
-  /// \param algo  the algo to run: "auto", "derivation", or "expansion".
+  /// \param rs     the expressionset
+  /// \param r      the expression
+  /// \param algo   the algo to run: "auto", "derivation", or "expansion".
+  /// \param cache  if not null, the expansions to reuse and complete.
   template <typename ExpSet>
   std::enable_if_t<!labelset_t_of<ExpSet>::is_letterized(),
     expression_automaton<mutable_automaton<typename ExpSet::context_t>>>
   derived_term(const ExpSet& rs,
                const typename ExpSet::value_t& r,
-               const std::string& algo = "auto")
+               const std::string& algo = "auto",
+               std::shared_ptr<rat::expansion_cache<ExpSet>> cache = nullptr)
   {
     auto a = detail::derived_term_algo(algo);
     require(a.algo == detail::derived_term_algo::expansion,
@@ -359,7 +430,7 @@ namespace vcsn
     // Do not call the operator(), this would trigger the compilation
     // of via_derivation, which does not compile (on purpose) for non
     // letterized labelsets.
-    auto dt = make_derived_term_automaton(rs, a);
+    auto dt = make_derived_term_automaton(rs, a, std::move(cache));
     return dt->via_expansion(r);
   }
 
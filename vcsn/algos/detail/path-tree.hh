@@ -0,0 +1,243 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*------------.
+    | path_tree.  |
+    `------------*/
+
+    /// A set of words stored as a tree of back-pointers.
+    ///
+    /// Algorithms that enumerate paths (e.g., lightest, shortest)
+    /// used to carry the whole word read so far, copying the prefix
+    /// at every extension, which is quadratic in the length of the
+    /// words.  Here, a word is denoted by a node: its parent is the
+    /// word without its last label.  Extending a word costs a hash
+    /// table lookup, and words are materialized only on demand
+    /// (typically when a result is emitted).
+    ///
+    /// Nodes are hash-consed: extending the same node by the same
+    /// label twice yields the same node.  Hence, for single-tape
+    /// letter labelsets (lal, and lan, as spontaneous labels do not
+    /// create nodes), two nodes denote the same word iff they are
+    /// equal, and words can be compared without being materialized.
+    ///
+    /// Other labelsets (law, lat...) do not enjoy this property: the
+    /// same word may be spelled by different sequences of labels.
+    /// In that case, see the specialization below, nodes are simply
+    /// the words themselves.
+    ///
+    /// \tparam Context  the context of the automaton (whose labels
+    ///                  are used to extend the words).
+    /// \tparam WordSet  the labelset of the words.
+    template <typename Context, typename WordSet,
+              bool Shared = Context::is_lal || Context::is_lan>
+    class path_tree
+    {
+    public:
+      using context_t = Context;
+      using labelset_t = labelset_t_of<context_t>;
+      using label_t = label_t_of<context_t>;
+      using wordset_t = WordSet;
+      using word_t = typename wordset_t::value_t;
+
+      /// Node identifiers.
+      using node_t = unsigned;
+
+      path_tree(const wordset_t& ws)
+        : ws_{ws}
+      {
+        nodes_.emplace_back(node{root(), root(), label_t{}, 0});
+      }
+
+      /// The node of the empty word.
+      static constexpr node_t root()
+      {
+        return 0;
+      }
+
+      /// The node denoting the word of \a n followed by \a l.
+      node_t extend(node_t n, const label_t& l)
+      {
+        if (labelset_t::is_one(l))
+          return n;
+        auto k = key_t{n, l};
+        auto i = children_.find(k);
+        if (i != end(children_))
+          return i->second;
+        else
+          {
+            // Skew-binary jump pointers (Myers, 1983): the
+            // destination of the jump depends only on the depth.
+            const auto j = nodes_[n].jump;
+            const auto jj = nodes_[j].jump;
+            const auto jump
+              = nodes_[n].depth - nodes_[j].depth == nodes_[j].depth - nodes_[jj].depth
+              ? jj : n;
+            const auto res = node_t(nodes_.size());
+            nodes_.emplace_back(node{n, jump, l, nodes_[n].depth + 1});
+            children_.emplace(std::move(k), res);
+            return res;
+          }
+      }
+
+      /// The length of the word denoted by \a n.
+      size_t size(node_t n) const
+      {
+        return nodes_[n].depth;
+      }
+
+      /// Whether \a l and \a r denote the same word.
+      static bool equal(node_t l, node_t r)
+      {
+        return l == r;
+      }
+
+      /// Whether the word of \a l is less than that of \a r, in the
+      /// order of the wordset (shortlex).
+      bool less(node_t l, node_t r) const
+      {
+        if (l == r)
+          return false;
+        else if (nodes_[l].depth != nodes_[r].depth)
+          return nodes_[l].depth < nodes_[r].depth;
+        else
+          {
+            // Same length, different words: climb up to the first
+            // different letters (the children of the common
+            // ancestor), in O(log(depth)) steps.
+            while (nodes_[l].parent != nodes_[r].parent)
+              if (nodes_[l].jump != nodes_[r].jump)
+                {
+                  l = nodes_[l].jump;
+                  r = nodes_[r].jump;
+                }
+              else
+                {
+                  l = nodes_[l].parent;
+                  r = nodes_[r].parent;
+                }
+            return labelset_t::less(nodes_[l].label, nodes_[r].label);
+          }
+      }
+
+      /// The word denoted by \a n.
+      word_t word(node_t n) const
+      {
+        // The labels, in reverse order.
+        auto labels = std::vector<word_t>{};
+        labels.reserve(nodes_[n].depth);
+        for (; n != root(); n = nodes_[n].parent)
+          labels.emplace_back(ws_.mul(ws_.one(), nodes_[n].label));
+        if (labels.empty())
+          return ws_.one();
+        // Balanced concatenation: O(n log n) instead of O(n^2) for
+        // left-to-right concatenation.
+        for (auto len = labels.size(); 1 < len; len = (len + 1) / 2)
+          for (size_t i = 0; 2 * i < len; ++i)
+            labels[i] = 2 * i + 1 < len
+              ? ws_.mul(labels[2 * i + 1], labels[2 * i])
+              : std::move(labels[2 * i]);
+        return std::move(labels[0]);
+      }
+
+    private:
+      struct node
+      {
+        /// The word without its last label.
+        node_t parent;
+        /// An ancestor, to climb up quickly.
+        node_t jump;
+        /// The last label.
+        label_t label;
+        /// The number of labels.
+        unsigned depth;
+      };
+
+      /// Children of a node are indexed by their parent and label.
+      using key_t = std::pair<node_t, label_t>;
+      struct key_hash
+      {
+        size_t operator()(const key_t& k) const
+        {
+          size_t res = 0;
+          hash_combine(res, k.first);
+          hash_combine_hash(res, labelset_t::hash(k.second));
+          return res;
+        }
+      };
+      struct key_equal
+      {
+        bool operator()(const key_t& l, const key_t& r) const
+        {
+          return l.first == r.first && labelset_t::equal(l.second, r.second);
+        }
+      };
+
+      /// The wordset used to materialize words.
+      const wordset_t& ws_;
+      /// The nodes, indexed by node_t.
+      std::vector<node> nodes_;
+      /// Parent and label to node.
+      std::unordered_map<key_t, node_t, key_hash, key_equal> children_;
+    };
+
+    /// Words that cannot be shared: nodes are the words themselves.
+    template <typename Context, typename WordSet>
+    class path_tree<Context, WordSet, false>
+    {
+    public:
+      using context_t = Context;
+      using label_t = label_t_of<context_t>;
+      using wordset_t = WordSet;
+      using word_t = typename wordset_t::value_t;
+      using node_t = word_t;
+
+      path_tree(const wordset_t& ws)
+        : ws_{ws}
+      {}
+
+      node_t root() const
+      {
+        return ws_.one();
+      }
+
+      node_t extend(const node_t& n, const label_t& l) const
+      {
+        return ws_.mul(n, l);
+      }
+
+      size_t size(const node_t& n) const
+      {
+        return ws_.size(n);
+      }
+
+      static bool equal(const node_t& l, const node_t& r)
+      {
+        return wordset_t::equal(l, r);
+      }
+
+      static bool less(const node_t& l, const node_t& r)
+      {
+        return wordset_t::less(l, r);
+      }
+
+      static const word_t& word(const node_t& n)
+      {
+        return n;
+      }
+
+    private:
+      const wordset_t& ws_;
+    };
+  }
+}
@@ -10,6 +10,7 @@
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/dyn/automaton.hh> // dyn::make_automaton
 #include <vcsn/dyn/fwd.hh>
+#include <vcsn/labelset/label-map.hh>
 #include <vcsn/misc/getargs.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/weightset/polynomialset.hh>
@@ -136,8 +137,7 @@ namespace vcsn
         if (Lazy)
           aut_->set_lazy(src, false);
         // label -> <destination, sum of weights>.
-        using dests_t
-          = std::map<label_t, state_name_t, vcsn::less<labelset_t>>;
+        using dests_t = vcsn::label_map_t<labelset_t, state_name_t>;
         auto dests = dests_t{};
         for (const auto& p : ss)
           {
@@ -163,7 +163,7 @@ namespace vcsn
               {
                 auto j = dests.find(p.first);
                 if (j == dests.end())
-                  dests[p.first] = p.second;
+                  dests.emplace(p.first, p.second);
                 else
                   aut_->ns_.add_here(j->second, p.second);
               }
@@ -189,8 +189,7 @@ namespace vcsn
         if (Lazy)
           aut_->set_lazy(src, false);
         // label -> <destination, sum of weights>.
-        using dests_t
-          = std::map<label_t, state_name_t, vcsn::less<labelset_t>>;
+        using dests_t = vcsn::label_map_t<labelset_t, state_name_t>;
         auto dests = dests_t{};
         for (const auto& p : ss)
           {
@@ -204,9 +203,10 @@ namespace vcsn
 
                 // For each letter, update destination state, and
                 // sum of weights.
-                if (!has(dests, l))
-                  dests.emplace(l, aut_->zero());
-                aut_->ns_.add_here(dests[l], dst, w);
+                auto i = dests.find(l);
+                if (i == dests.end())
+                  i = dests.emplace(l, aut_->zero()).first;
+                aut_->ns_.add_here(i->second, dst, w);
               }
           }
 
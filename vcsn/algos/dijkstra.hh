@@ -1,8 +1,12 @@
 #pragma once
 
+#include <type_traits>
+
 #include <vcsn/algos/tags.hh>
 #include <vcsn/core/mutable-automaton.hh>
 #include <vcsn/misc/fibonacci_heap.hh>
+#include <vcsn/misc/radix_heap.hh>
+#include <vcsn/weightset/weightset.hh> // is_tropical
 
 namespace vcsn
 {
@@ -15,7 +19,9 @@ namespace vcsn
   {
     /// Dijkstra implementation of lightest automaton.
     ///
-    /// Uses Fibonacci heaps.
+    /// The queue of states depends on the values: radix heap for
+    /// integral tropical weights (nmin, zmin), 4-ary heap for
+    /// floating point ones (rmin, log...), Fibonacci heap otherwise.
     /// No preconditions.
     ///
     /// Functor taking an automaton as parameter and applying
@@ -54,44 +60,136 @@ namespace vcsn
       {
         profile(state_t state, const self_t& d)
           : state_(state)
-          , self_(d)
+          , self_(&d)
         {}
 
         bool operator<(const profile& rhs) const
         {
-          if (self_.res_[rhs.state_] == self_.aut_->null_transition())
+          if (self_->res_[rhs.state_] == self_->aut_->null_transition())
             return true;
-          else if (self_.res_[state_] == self_.aut_->null_transition())
+          else if (self_->res_[state_] == self_->aut_->null_transition())
             return false;
           else
-            return self_.vs_.less(self_.dist_[state_], self_.dist_[rhs.state_]);
+            return self_->vs_.less(self_->dist_[state_],
+                                   self_->dist_[rhs.state_]);
         }
 
         state_t state_;
+        /// A pointer, not a reference, to be copy-assignable.
+        const self_t* self_;
+      };
+
+      /// The states to visit, in a mutable heap of profiles.
+      template <typename Heap>
+      class heap_queue
+      {
+      public:
+        heap_queue(const self_t& d)
+          : self_(d)
+          // FIXME: this will not work if the automaton is lazy.  We
+          // must _never_ depend on states_size.  We really need
+          // something like state_map_t that is able to grow on
+          // demand with lazy automata.
+          , handles_(states_size(d.aut_))
+        {}
+
+        bool empty() const
+        {
+          return heap_.empty();
+        }
+
+        void push(state_t s)
+        {
+          handles_[s] = heap_.push(profile{s, self_});
+        }
+
+        /// The distance of \a s was decreased.
+        void update(state_t s)
+        {
+          heap_.update(handles_[s]);
+        }
+
+        state_t pop()
+        {
+          auto res = heap_.top().state_;
+          heap_.pop();
+          return res;
+        }
+
+      private:
+        const self_t& self_;
+        Heap heap_;
+        std::vector<typename Heap::handle_type> handles_;
+      };
+
+      /// The states to visit, in a radix heap, for integral distances.
+      ///
+      /// There is no decrease-key: updated states are pushed again,
+      /// and their outdated entries are skipped.
+      class radix_queue
+      {
+      public:
+        radix_queue(const self_t& d)
+          : self_(d)
+        {}
+
+        bool empty()
+        {
+          skip_();
+          return heap_.empty();
+        }
+
+        void push(state_t s)
+        {
+          heap_.emplace(self_.dist_[s], s);
+        }
+
+        /// The distance of \a s was decreased.
+        void update(state_t s)
+        {
+          push(s);
+        }
+
+        state_t pop()
+        {
+          skip_();
+          auto res = heap_.top();
+          heap_.pop();
+          return res;
+        }
+
+      private:
+        /// Pop the outdated entries.
+        void skip_()
+        {
+          while (!heap_.empty()
+                 && heap_.top_key() != self_.dist_[heap_.top()])
+            heap_.pop();
+        }
+
         const self_t& self_;
+        min_radix_heap<value_t, state_t> heap_;
       };
 
-      using heap_t = vcsn::min_fibonacci_heap<profile>;
+      using queue_t
+        = std::conditional_t<(is_tropical<valueset_t>::value
+                              && std::is_integral<value_t>::value),
+                             radix_queue,
+          std::conditional_t<std::is_floating_point<value_t>::value,
+                             heap_queue<vcsn::min_d_ary_heap<profile>>,
+                             heap_queue<vcsn::min_fibonacci_heap<profile>>>>;
 
       predecessors_t_of<automaton_t>
       operator()(state_t source, state_t dest)
       {
-        // FIXME: this will not work if the automaton is lazy.  We
-        // must _never_ depend on states_size.  We really need
-        // something like state_map_t that is able to grow on demand
-        // with lazy automata.
-        auto size = states_size(aut_);
-        auto handles = std::vector<typename heap_t::handle_type>(size);
-        auto todo = heap_t();
+        auto todo = queue_t(*this);
 
         dist_[source] = vs_.one();
-        handles[source] = todo.emplace(source, *this);
+        todo.push(source);
 
         while (!todo.empty())
           {
-            auto p = todo.top();
-            todo.pop();
-            state_t s = p.state_;
+            state_t s = todo.pop();
             if (s == dest)
               break;
             else
@@ -104,14 +202,14 @@ namespace vcsn
                       // First visit.
                       dist_[dst] = nv;
                       res_[dst] = t;
-                      handles[dst] = todo.emplace(dst, *this);
+                      todo.push(dst);
                     }
                   else if (vs_.less(nv, dist_[dst]))
                     {
                       // Lighter path.
                       dist_[dst] = nv;
                       res_[dst] = t;
-                      todo.update(handles[dst]);
+                      todo.update(dst);
                     }
                 }
           }
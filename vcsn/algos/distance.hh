@@ -1,9 +1,13 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath> // std::abs
+#include <functional> // std::less
 #include <iostream>
 #include <limits>
 #include <queue>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
@@ -11,52 +15,396 @@
 #include <boost/range/algorithm/max_element.hpp>
 
 #include <vcsn/algos/copy.hh>
+#include <vcsn/algos/lightest-path.hh> // has_lightening_transitions
 #include <vcsn/ctx/context.hh>
 #include <vcsn/dyn/value.hh>
 #include <vcsn/misc/deque.hh>
+#include <vcsn/misc/direction.hh>
+#include <vcsn/misc/getargs.hh>
 #include <vcsn/misc/pair.hh>
 #include <vcsn/misc/queue.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/weightset/fwd.hh> // b
 #include <vcsn/weightset/nmin.hh>
+#include <vcsn/weightset/weightset.hh> // is_tropical
 
 namespace vcsn
 {
-  /// Single source shortest distance.
-  /// Find shortest (weighted) path from state \a s0
-  /// to all states of automaton \a aut.
-  template <Automaton Aut>
-  std::vector<weight_t_of<Aut>>
-  ss_shortest_distance(const Aut& aut, state_t_of<Aut> s0)
+  namespace detail
   {
-    using weight_t = weight_t_of<Aut>;
-    using state_t = state_t_of<Aut>;
+    /*-------------------------.
+    | shortest_distance_impl.  |
+    `-------------------------*/
 
-    auto ws = *aut->weightset();
-    auto d = std::vector<weight_t>(states_size(aut), ws.zero());
-    d[s0] = ws.one();
-    auto r = d;
+    /// Generic single-source shortest distance: the sum (in the
+    /// weightset) of the weights of all the paths from a source
+    /// state, to every state (or from every state to a destination,
+    /// backward).
+    ///
+    /// Based on `Semiring frameworks and algorithms for shortest-distance
+    /// problems`, Mohri (2002): a state is processed when the weight
+    /// added to its distance since its last processing (its
+    /// "residual") is not null.  This is exact on acyclic automata,
+    /// and on k-closed weightsets (e.g., B and the tropical
+    /// weightsets without lightening cycles).  On floating point
+    /// weightsets (R, Log), the distances converge numerically, or
+    /// up to \a epsilon (relatively) if it is not null.  Other
+    /// weightsets (Z, Q) may not converge on cycles: see all_distances.
+    ///
+    /// The order in which states are processed is given by \a algo:
+    ///
+    /// - "fifo": first in, first out;
+    /// - "shortest-first": the lightest distance first (as Dijkstra's
+    ///   algorithm), for tropical weightsets;
+    /// - "topological": each state once, after its predecessors;
+    ///   requires an acyclic automaton;
+    /// - "auto": "topological" if the automaton is acyclic,
+    ///   "shortest-first" on tropical weightsets without lightening
+    ///   weights, "fifo" otherwise.
+    ///
+    /// The object can be run from several sources: each run only
+    /// resets the states reached by the previous one.
+    ///
+    /// \tparam Dir  forward: distances from the source; backward:
+    ///              distances to the destination.
+    template <Automaton Aut, direction Dir = direction::forward>
+    class shortest_distance_impl
+    {
+    public:
+      using automaton_t = Aut;
+      using state_t = state_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = weight_t_of<automaton_t>;
 
-    auto todo = std::deque<state_t>{s0};
-    while (!todo.empty())
+      shortest_distance_impl(const automaton_t& aut,
+                             const std::string& algo = "auto",
+                             double epsilon = 0)
+        : aut_{aut}
+        , epsilon_{epsilon}
+        , dist_(states_size(aut_), ws_.zero())
+        , residual_(states_size(aut_), ws_.zero())
+        , queued_(states_size(aut_), false)
+        , pushes_(states_size(aut_), 0)
+        , is_reached_(states_size(aut_), false)
       {
-        auto s = todo.front();
-        todo.pop_front();
-        auto r1 = r[s];
-        r[s] = ws.zero();
-        for (auto t : all_out(aut, s))
+        if (algo == "auto" || algo == "topological")
+          sort_();
+        if (algo == "auto")
+          queue_ = is_acyclic() ? topological
+            : is_tropical<weightset_t>::value
+              && !has_lightening_transitions(aut_) ? shortest_first
+            : fifo;
+        else
           {
-            auto dst = aut->dst_of(t);
-            auto w1 = ws.mul(r1, aut->weight_of(t));
-            auto w = ws.add(d[dst], w1);
-            if (!ws.equal(d[dst], w))
+            static const auto map = getarg<queue_kind>
               {
-                d[dst] = w;
-                r[dst] = ws.add(r[dst], w1);
-                if (!has(todo, dst))
-                  todo.emplace_back(dst);
+                "shortest distance algorithm",
+                {
+                  {"fifo",           fifo},
+                  {"shortest-first", shortest_first},
+                  {"topological",    topological},
+                }
+              };
+            queue_ = map[algo];
+            require(queue_ != topological || is_acyclic(),
+                    "shortest_distance: topological order",
+                    " requires an acyclic automaton");
+          }
+      }
+
+      /// Whether the automaton is acyclic (known only with "auto" or
+      /// "topological").
+      bool is_acyclic() const
+      {
+        return !rank_.empty();
+      }
+
+      /// Whether the distances are exact (on B, and tropical
+      /// weightsets, which fail on lightening cycles), or the
+      /// automaton is acyclic.
+      bool is_exact() const
+      {
+        return (is_tropical<weightset_t>::value
+                || std::is_same<weightset_t, b>::value
+                || is_acyclic());
+      }
+
+      /// The distances from (forward) or to (backward) \a s, indexed
+      /// by state.  Valid until the next run.
+      const std::vector<weight_t>& operator()(state_t s)
+      {
+        for (auto r: reached_)
+          {
+            dist_[r] = ws_.zero();
+            residual_[r] = ws_.zero();
+            pushes_[r] = 0;
+            is_reached_[r] = false;
+          }
+        reached_.clear();
+        reached_.emplace_back(s);
+        is_reached_[s] = true;
+        dist_[s] = residual_[s] = ws_.one();
+        switch (queue_)
+          {
+          case fifo:
+            run_(fifo_queue{});
+            break;
+          case shortest_first:
+            run_(make_priority_queue_<weight_t, weight_less>
+                 ([this](state_t s) { return dist_[s]; }));
+            break;
+          case topological:
+            run_(make_priority_queue_<size_t, std::less<size_t>>
+                 ([this](state_t s) { return rank_[s]; }));
+            break;
+          }
+        return dist_;
+      }
+
+      /// The states reached by the last run, each one once.  Their
+      /// distance may be zero (e.g., in Z, when paths cancel out).
+      const std::vector<state_t>& reached() const
+      {
+        return reached_;
+      }
+
+    private:
+      enum queue_kind { fifo, shortest_first, topological };
+
+      struct fifo_queue
+      {
+        void push(state_t s) { q_.emplace_back(s); }
+        state_t pop()
+        {
+          auto res = q_.front();
+          q_.pop_front();
+          return res;
+        }
+        bool empty() const { return q_.empty(); }
+        std::deque<state_t> q_;
+      };
+
+      /// A heap of states, with their key when they were pushed.  A
+      /// state may be pushed several times, see run_.
+      template <typename Key, typename Less, typename KeyOf>
+      struct priority_queue
+      {
+        using entry_t = std::pair<Key, state_t>;
+        void push(state_t s) { q_.emplace(key_of(s), s); }
+        state_t pop()
+        {
+          auto res = q_.top().second;
+          q_.pop();
+          return res;
+        }
+        bool empty() const { return q_.empty(); }
+        struct greater
+        {
+          bool operator()(const entry_t& l, const entry_t& r) const
+          {
+            return Less{}(r.first, l.first);
+          }
+        };
+        KeyOf key_of;
+        std::priority_queue<entry_t, std::vector<entry_t>, greater> q_;
+      };
+
+      template <typename Key, typename Less, typename KeyOf>
+      static priority_queue<Key, Less, KeyOf>
+      make_priority_queue_(KeyOf key_of)
+      {
+        return {key_of, {}};
+      }
+
+      struct weight_less
+      {
+        bool operator()(const weight_t& l, const weight_t& r) const
+        {
+          return weightset_t::less(l, r);
+        }
+      };
+
+      /// The transitions leaving \a s, in the direction of the search.
+      auto next_(state_t s) const
+      {
+        return next_(s, std::integral_constant<direction, Dir>{});
+      }
+
+      auto next_(state_t s,
+                 std::integral_constant<direction, direction::forward>) const
+      {
+        return all_out(aut_, s);
+      }
+
+      auto next_(state_t s,
+                 std::integral_constant<direction, direction::backward>) const
+      {
+        return all_in(aut_, s);
+      }
+
+      state_t next_state_(transition_t_of<automaton_t> t) const
+      {
+        return Dir == direction::forward ? aut_->dst_of(t) : aut_->src_of(t);
+      }
+
+      /// Extend a path of weight \a w with transition \a t.
+      weight_t mul_(const weight_t& w, transition_t_of<automaton_t> t) const
+      {
+        return Dir == direction::forward
+          ? ws_.mul(w, aut_->weight_of(t))
+          : ws_.mul(aut_->weight_of(t), w);
+      }
+
+      /// Whether \a l and \a r are equal, up to epsilon_.
+      bool equal_(const weight_t& l, const weight_t& r) const
+      {
+        return equal_(l, r, std::is_floating_point<weight_t>{});
+      }
+
+      bool equal_(const weight_t& l, const weight_t& r, std::true_type) const
+      {
+        return l == r || std::abs(l - r) <= epsilon_ * std::abs(r);
+      }
+
+      bool equal_(const weight_t& l, const weight_t& r, std::false_type) const
+      {
+        return ws_.equal(l, r);
+      }
+
+      template <typename Queue>
+      void run_(Queue&& todo)
+      {
+        auto s0 = reached_.front();
+        todo.push(s0);
+        queued_[s0] = true;
+        while (!todo.empty())
+          {
+            auto s = todo.pop();
+            // States may be pushed several times in priority queues,
+            // since their key changes: process them once.
+            if (!queued_[s])
+              continue;
+            queued_[s] = false;
+            // Not `auto`: for B, a reference in a std::vector<bool>.
+            weight_t r = std::move(residual_[s]);
+            residual_[s] = ws_.zero();
+            for (auto t: next_(s))
+              {
+                auto n = next_state_(t);
+                auto w = mul_(r, t);
+                auto d = ws_.add(dist_[n], w);
+                if (!equal_(dist_[n], d))
+                  {
+                    if (!is_reached_[n])
+                      {
+                        is_reached_[n] = true;
+                        reached_.emplace_back(n);
+                      }
+                    dist_[n] = std::move(d);
+                    residual_[n] = ws_.add(residual_[n], w);
+                    if (!queued_[n] || queue_ == shortest_first)
+                      {
+                        // Bellman-Ford: without lightening cycles, a
+                        // state is queued at most once per pass.
+                        require(queue_ != fifo
+                                || !is_tropical<weightset_t>::value
+                                || ++pushes_[n] <= dist_.size(),
+                                "shortest_distance: automaton with a"
+                                " lightening cycle");
+                        queued_[n] = true;
+                        todo.push(n);
+                      }
+                  }
               }
           }
-    }
-    return d;
+      }
+
+      /// Compute the topological order, if the automaton is acyclic.
+      void sort_()
+      {
+        // Iterative depth-first search: the postorder is the reverse
+        // of a topological order.
+        enum color { white, gray, black };
+        auto colors = std::vector<color>(states_size(aut_), white);
+        auto post = std::vector<state_t>{};
+        post.reserve(states_size(aut_));
+        using iterator_t = decltype(next_(aut_->pre()).begin());
+        auto todo = std::vector<std::tuple<state_t, iterator_t, iterator_t>>{};
+        for (auto s0: aut_->all_states())
+          if (colors[s0] == white)
+            {
+              auto ts = next_(s0);
+              colors[s0] = gray;
+              todo.emplace_back(s0, ts.begin(), ts.end());
+              while (!todo.empty())
+                {
+                  auto& top = todo.back();
+                  if (std::get<1>(top) == std::get<2>(top))
+                    {
+                      colors[std::get<0>(top)] = black;
+                      post.emplace_back(std::get<0>(top));
+                      todo.pop_back();
+                    }
+                  else
+                    {
+                      auto n = next_state_(*std::get<1>(top)++);
+                      if (colors[n] == gray)
+                        // A cycle.
+                        return;
+                      else if (colors[n] == white)
+                        {
+                          auto nts = next_(n);
+                          colors[n] = gray;
+                          todo.emplace_back(n, nts.begin(), nts.end());
+                        }
+                    }
+                }
+            }
+        rank_.resize(states_size(aut_));
+        auto i = post.size();
+        for (auto s: post)
+          rank_[s] = --i;
+      }
+
+      /// The automaton.
+      const automaton_t aut_;
+      const weightset_t& ws_ = *aut_->weightset();
+      /// The queue discipline.
+      queue_kind queue_;
+      /// The convergence threshold, for floating point weights.
+      const double epsilon_;
+      /// The distances.
+      std::vector<weight_t> dist_;
+      /// The weight added to the distance since the last processing.
+      std::vector<weight_t> residual_;
+      /// Whether the state is to be processed.
+      std::vector<bool> queued_;
+      /// The number of times each state was queued.
+      std::vector<size_t> pushes_;
+      /// The states reached by the last run.
+      std::vector<state_t> reached_;
+      /// Whether the state is in reached_.
+      std::vector<bool> is_reached_;
+      /// The position of each state in a topological order (empty if
+      /// there is none).
+      std::vector<size_t> rank_;
+    };
+  }
+
+  /// Single source shortest distance: the sum of the weights of the
+  /// paths from state \a s0 to all the states of automaton \a aut.
+  ///
+  /// \param aut      the automaton.
+  /// \param s0       the source state.
+  /// \param algo     the queue discipline, see shortest_distance_impl.
+  /// \param epsilon  the relative precision on floating point weights.
+  template <Automaton Aut>
+  std::vector<weight_t_of<Aut>>
+  ss_shortest_distance(const Aut& aut, state_t_of<Aut> s0,
+                       const std::string& algo = "auto", double epsilon = 0)
+  {
+    auto sd = detail::shortest_distance_impl<Aut>{aut, algo, epsilon};
+    return sd(s0);
   }
 
   /// Find the shortest paths from some states to all the states.
@@ -123,13 +471,17 @@ namespace vcsn
     for (auto k : aut->states())
       {
         auto reskk = res[k][k] = ws->star(res[k][k]);
+        // Rows and columns of deleted states are null, so we can
+        // work on whole rows: res[i][j] += res[i][k] * reskk *
+        // res[k][j], for j != k.
         for (auto i : aut->all_states())
-          for (auto j : aut->all_states())
-            if (i != k && j != k)
-              res[i][j] = ws->add(
-                res[i][j],
-                ws->mul(res[i][k], reskk, res[k][j])
-              );
+          if (i != k)
+            {
+              auto a = ws->mul(res[i][k], reskk);
+              ws->axpy(begin(res[i]), a, begin(res[k]), k);
+              ws->axpy(begin(res[i]) + k + 1, a,
+                       begin(res[k]) + k + 1, n - (k + 1));
+            }
         for (auto i : aut->all_states())
           if (i != k)
             {
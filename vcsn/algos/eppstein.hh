@@ -1,7 +1,10 @@
 #pragma once
 
+#include <queue>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <vcsn/misc/fibonacci_heap.hh>
 #include <vcsn/misc/unordered_map.hh>
 #include <vcsn/algos/path.hh>
@@ -120,6 +123,252 @@ namespace vcsn
 
       const automaton_t& aut_;
     };
+
+    /// Lazy version of Eppstein's algorithm: an enumerator of the
+    /// paths from \a src to \a dst, lightest first.
+    ///
+    /// Each call returns the next path, so that the first ones are
+    /// available without knowing how many are needed.  Sidetracks
+    /// are stored in persistent leftist heaps: the heap of a state is
+    /// that of its parent in the shortest path tree, extended with
+    /// its own sidetracks, and shares most of its nodes with it.
+    /// These heaps are built lazily, when a path reaches their state
+    /// for the first time.  Each path then costs O(log n) amortized.
+    ///
+    /// Based on `Finding the k shortest paths`, David Eppstein (1997),
+    /// and on the persistent variant of Kaplan et al. (2000).
+    template <Automaton Aut>
+    class lazy_eppstein
+    {
+      using automaton_t = Aut;
+      using state_t = state_t_of<automaton_t>;
+      using transition_t = transition_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = weight_t_of<automaton_t>;
+      using path_t = path<automaton_t>;
+
+    public:
+      lazy_eppstein(const automaton_t& aut, state_t src, state_t dst)
+        : aut_{aut}
+        , src_{src}
+        , dst_{dst}
+        , tree_{aut_, dst_}
+      {
+        // The null heap.
+        heap_.emplace_back(heap_node{ws_.one(), aut_->null_transition(),
+                                     null_heap, null_heap, 0});
+        // The empty sequence of sidetracks.
+        sidetracks_.emplace_back(aut_->null_transition(), 0);
+      }
+
+      /// The tree and the paths refer to aut_.
+      lazy_eppstein(const lazy_eppstein&) = delete;
+
+      /// The next lightest path, if there is one.
+      boost::optional<path_t> operator()()
+      {
+        if (!started_)
+          {
+            started_ = true;
+            if (!reaches_(src_))
+              return boost::none;
+            auto h = heap_of_(src_);
+            if (h != null_heap)
+              queue_.push(candidate{ws_.mul(tree_.get_weight_of(src_),
+                                            heap_[h].key),
+                                    h, 0});
+            return explicit_path_(0);
+          }
+        else if (queue_.empty())
+          return boost::none;
+        else
+          {
+            auto c = queue_.top();
+            queue_.pop();
+            // Copy, as heap_of_ may reallocate heap_.
+            const auto n = heap_[c.node];
+            // Replace this sidetrack by a heavier one of the same heap.
+            for (auto child: {n.left, n.right})
+              if (child != null_heap)
+                queue_.push(candidate{ws_.mul(ws_.rdivide(c.weight, n.key),
+                                              heap_[child].key),
+                                      child, c.sidetracks});
+            // Keep this sidetrack, and look for another one, further.
+            const auto seq = unsigned(sidetracks_.size());
+            sidetracks_.emplace_back(n.sidetrack, c.sidetracks);
+            auto h = heap_of_(aut_->dst_of(n.sidetrack));
+            if (h != null_heap)
+              queue_.push(candidate{ws_.mul(c.weight, heap_[h].key),
+                                    h, seq});
+            return explicit_path_(seq);
+          }
+      }
+
+    private:
+      /// Index of a node in heap_.
+      using heap_t = unsigned;
+      static constexpr heap_t null_heap = 0;
+
+      /// A node of a persistent leftist heap of sidetracks.
+      struct heap_node
+      {
+        /// The additional cost of taking this sidetrack.
+        weight_t key;
+        transition_t sidetrack;
+        heap_t left;
+        heap_t right;
+        /// Length of the right spine.
+        unsigned rank;
+      };
+
+      /// A path in the queue: a sequence of sidetracks, followed by
+      /// the sidetrack of a heap node.
+      struct candidate
+      {
+        weight_t weight;
+        heap_t node;
+        /// Index in sidetracks_ of the previous sidetracks.
+        unsigned sidetracks;
+      };
+
+      struct candidate_greater
+      {
+        bool operator()(const candidate& l, const candidate& r) const
+        {
+          return weightset_t::less(r.weight, l.weight);
+        }
+      };
+
+      /// Whether \a s can reach dst_.
+      bool reaches_(state_t s) const
+      {
+        return s == dst_ || tree_.get_parent_of(s) != aut_->null_state();
+      }
+
+      /// The transition from \a s to its parent in the tree.
+      transition_t tree_transition_(state_t s)
+      {
+        auto i = tree_transitions_.find(s);
+        if (i == end(tree_transitions_))
+          {
+            const auto& ws = ws_;
+            const auto& aut = aut_;
+            auto t = min_forward(detail::outin(aut_, s, tree_.get_parent_of(s)),
+                                 [&ws, &aut] (auto t1, auto t2)
+                                 {
+                                   return ws.less(aut->weight_of(t1),
+                                                  aut->weight_of(t2));
+                                 });
+            i = tree_transitions_.emplace(s, t).first;
+          }
+        return i->second;
+      }
+
+      /// The union of \a l and \a r, sharing them.
+      heap_t merge_(heap_t l, heap_t r)
+      {
+        if (l == null_heap)
+          return r;
+        else if (r == null_heap)
+          return l;
+        else
+          {
+            if (ws_.less(heap_[r].key, heap_[l].key))
+              std::swap(l, r);
+            auto res = heap_[l];
+            res.right = merge_(res.right, r);
+            if (heap_[res.left].rank < heap_[res.right].rank)
+              std::swap(res.left, res.right);
+            res.rank = heap_[res.right].rank + 1;
+            heap_.emplace_back(res);
+            return heap_t(heap_.size() - 1);
+          }
+      }
+
+      /// The heap of the sidetracks on the tree path from \a s to dst_.
+      heap_t heap_of_(state_t s)
+      {
+        // The states whose heap is not built yet, from s upwards.
+        auto todo = std::vector<state_t>{};
+        for (; !has(heaps_, s); s = tree_.get_parent_of(s))
+          {
+            todo.emplace_back(s);
+            if (s == dst_)
+              break;
+          }
+        auto res = has(heaps_, s) ? heaps_[s] : null_heap;
+        for (auto i = todo.rbegin(); i != todo.rend(); ++i)
+          {
+            const auto tree_t
+              = *i == dst_ ? aut_->null_transition() : tree_transition_(*i);
+            const auto& w = tree_.get_weight_of(*i);
+            for (auto t: all_out(aut_, *i))
+              if (t != tree_t && reaches_(aut_->dst_of(t)))
+                {
+                  auto key
+                    = ws_.rdivide(ws_.mul(aut_->weight_of(t),
+                                          tree_.get_weight_of(aut_->dst_of(t))),
+                                  w);
+                  heap_.emplace_back(heap_node{std::move(key), t,
+                                               null_heap, null_heap, 1});
+                  res = merge_(res, heap_t(heap_.size() - 1));
+                }
+            heaps_.emplace(*i, res);
+          }
+        return res;
+      }
+
+      /// The path denoted by the sequence of sidetracks \a seq.
+      path_t explicit_path_(unsigned seq)
+      {
+        auto ts = std::vector<transition_t>{};
+        for (; seq; seq = sidetracks_[seq].second)
+          ts.emplace_back(sidetracks_[seq].first);
+
+        auto res = path_t(aut_);
+        // Follow the tree from s until state dst.
+        auto follow = [this, &res](state_t s, state_t dst)
+          {
+            for (; s != dst; )
+              {
+                auto t = tree_transition_(s);
+                res.emplace_back(aut_->weight_of(t), t);
+                s = aut_->dst_of(t);
+              }
+          };
+        auto s = src_;
+        for (auto i = ts.rbegin(); i != ts.rend(); ++i)
+          {
+            follow(s, aut_->src_of(*i));
+            res.emplace_back(aut_->weight_of(*i), *i);
+            s = aut_->dst_of(*i);
+          }
+        follow(s, dst_);
+        return res;
+      }
+
+      /// The automaton, referred to by the tree and the paths.
+      const automaton_t aut_;
+      const weightset_t& ws_ = *aut_->weightset();
+      const state_t src_;
+      const state_t dst_;
+      /// The lightest paths to dst_.
+      shortest_path_tree<automaton_t> tree_;
+      /// Cache of the tree transitions.
+      std::unordered_map<state_t, transition_t> tree_transitions_;
+      /// The nodes of all the heaps.
+      std::vector<heap_node> heap_;
+      /// The heap of each state whose heap was built.
+      std::unordered_map<state_t, heap_t> heaps_;
+      /// Sequences of sidetracks, as linked lists: each one is a
+      /// sidetrack, and the index of the previous ones.
+      std::vector<std::pair<transition_t, unsigned>> sidetracks_;
+      /// The paths to explore, lightest first.
+      std::priority_queue<candidate, std::vector<candidate>,
+                          candidate_greater> queue_;
+      /// Whether the first path was returned.
+      bool started_ = false;
+    };
   }
 
   /// Compute the \a num lightest paths in the automaton \a aut from \a src to
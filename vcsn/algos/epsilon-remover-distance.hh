@@ -1,12 +1,14 @@
 #pragma once
 
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/distance.hh>
+#include <vcsn/misc/vector.hh> // make_vector
 
 namespace vcsn
 {
@@ -81,32 +83,46 @@ namespace vcsn
             d2p_[dp.second] = pp->second;
             p2d_[pp->second] = dp.second;
           }
-
-        de_ = all_distances(aut_dirty_);
       }
 
     public:
 
       aut_proper_t operator()()
       {
-        for (auto dirty_p : aut_dirty_->states())
-          for (auto dirty_q : aut_dirty_->states())
+        // The new outgoing transitions of the dirty states.  They are
+        // installed once all of them are computed, since they depend
+        // on the original outgoing transitions.
+        auto outs = std::vector<std::vector<out_t>>(states_size(aut_dirty_));
+        auto sd = shortest_distance_impl<aut_dirty_t>{aut_dirty_};
+        if (sd.is_exact())
+          // One search per state, which visits only the states it
+          // reaches.
+          for (auto dirty_p : aut_dirty_->states())
             {
-              weight_t dist_pq = de_[dirty_p][dirty_q];
-              if (!ws_.is_zero(dist_pq))
-                {
-                  auto proper_q = d2p_[dirty_q];
-                  for (auto t : all_out(aut_proper_, proper_q))
-                    {
-                      auto proper_p = d2p_[dirty_p];
-                      auto proper_r = aut_proper_->dst_of(t);
-                      label_proper_t l = aut_proper_->label_of(t);
-                      weight_t w = aut_proper_->weight_of(t);
-                      aut_proper_->set_transition(proper_p, proper_r, l,
-                                                  ws_.mul(dist_pq, w));
-                    }
-                }
+              const auto& dist = sd(dirty_p);
+              for (auto dirty_q : sd.reached())
+                if (dirty_q != aut_dirty_->pre()
+                    && dirty_q != aut_dirty_->post())
+                  closure_(outs[dirty_p], dist[dirty_q], dirty_q);
             }
+        else
+          {
+            // The distances may not converge (e.g., in Q): compute
+            // the stars of the cycles.
+            const auto de = all_distances(aut_dirty_);
+            for (auto dirty_p : aut_dirty_->states())
+              for (auto dirty_q : aut_dirty_->states())
+                closure_(outs[dirty_p], de[dirty_p][dirty_q], dirty_q);
+          }
+        for (auto dirty_p : aut_dirty_->states())
+          {
+            auto proper_p = d2p_[dirty_p];
+            for (auto t : detail::make_vector(all_out(aut_proper_, proper_p)))
+              aut_proper_->del_transition(t);
+            for (const auto& o : outs[dirty_p])
+              aut_proper_->add_transition(proper_p, std::get<0>(o),
+                                          std::get<1>(o), std::get<2>(o));
+          }
         if (prune_)
           for (auto s : aut_proper_->states())
             if (all_in(aut_proper_, s).empty())
@@ -115,6 +131,21 @@ namespace vcsn
       }
 
     private:
+      /// An outgoing transition: destination, label, weight.
+      using out_t = std::tuple<state_proper_t, label_proper_t, weight_t>;
+
+      /// Add to \a outs the outgoing proper transitions of \a dirty_q,
+      /// reached with weight \a dist.
+      void closure_(std::vector<out_t>& outs, const weight_t& dist,
+                    state_dirty_t dirty_q) const
+      {
+        if (!ws_.is_zero(dist))
+          for (auto t : all_out(aut_proper_, d2p_[dirty_q]))
+            outs.emplace_back(aut_proper_->dst_of(t),
+                              aut_proper_->label_of(t),
+                              ws_.mul(dist, aut_proper_->weight_of(t)));
+      }
+
       /// The automata we work on.
       aut_proper_t aut_proper_;
       aut_dirty_t aut_dirty_;
@@ -129,8 +160,6 @@ namespace vcsn
       std::vector<state_proper_t> d2p_;
       /// proper states -> dirty states.
       std::vector<state_dirty_t> p2d_;
-
-      std::vector<std::vector<weight_t>> de_;
     };
 
     template <Automaton Aut>
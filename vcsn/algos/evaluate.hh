@@ -1,23 +1,167 @@
 #pragma once
 
+#include <algorithm> // std::equal, std::remove_if
+#include <unordered_map>
 #include <vector>
-#include <queue>
+
+#include <boost/optional.hpp>
 
 #include <vcsn/algos/is-proper.hh>
+#include <vcsn/algos/trie.hh> // quote
 #include <vcsn/core/automaton.hh> // out
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/dyn/value.hh>
 #include <vcsn/labelset/labelset.hh>
+#include <vcsn/labelset/letterset.hh>
+#include <vcsn/labelset/nullableset.hh>
+#include <vcsn/labelset/tupleset.hh>
 #include <vcsn/labelset/word-polynomialset.hh>
+#include <vcsn/labelset/wordset.hh>
 #include <vcsn/misc/algorithm.hh>
+#include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/pair.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/static-if.hh>
+#include <vcsn/misc/tuple.hh>
 #include <vcsn/misc/type_traits.hh>
 
 namespace vcsn
 {
   namespace detail
   {
+    /*-----------------------.
+    | Positions in a word.   |
+    `-----------------------*/
+
+    /// A position in a word of \a LabelSet: an offset, or a tuple of
+    /// offsets for tuplesets.
+    template <typename LabelSet>
+    struct word_position
+    {
+      using type = size_t;
+    };
+
+    template <typename... LabelSets>
+    struct word_position<tupleset<LabelSets...>>
+    {
+      using type = std::tuple<typename word_position<LabelSets>::type...>;
+    };
+
+    template <typename LabelSet>
+    using word_position_t = typename word_position<LabelSet>::type;
+
+    /// The number of letters before a position.
+    inline size_t position_level(size_t p)
+    {
+      return p;
+    }
+
+    template <typename... Positions>
+    size_t position_level(const std::tuple<Positions...>& p)
+    {
+      auto res = size_t{0};
+      for_(p, [&res](const auto& q) { res += position_level(q); });
+      return res;
+    }
+
+    /// The number of letters of a word.
+    template <typename LabelSet>
+    size_t word_level(const LabelSet&, const typename LabelSet::word_t& w)
+    {
+      return w.size();
+    }
+
+    template <typename... LabelSets, size_t... I>
+    size_t word_level_(const tupleset<LabelSets...>& ls,
+                       const typename tupleset<LabelSets...>::word_t& w,
+                       index_sequence<I...>)
+    {
+      auto res = size_t{0};
+      using swallow = int[];
+      (void) swallow
+        {
+          (res += word_level(ls.template set<I>(), std::get<I>(w)), 0)...
+        };
+      return res;
+    }
+
+    template <typename... LabelSets>
+    size_t word_level(const tupleset<LabelSets...>& ls,
+                      const typename tupleset<LabelSets...>::word_t& w)
+    {
+      return word_level_(ls, w, make_index_sequence<sizeof...(LabelSets)>{});
+    }
+
+    /// Match label \a l at position \a p of word \a w.
+    ///
+    /// \returns the position after \a l, if it matches.
+    template <typename GenSet>
+    boost::optional<size_t>
+    ldivide_at(const letterset<GenSet>& ls,
+               const typename letterset<GenSet>::value_t& l,
+               const typename letterset<GenSet>::word_t& w, size_t p)
+    {
+      if (p < w.size() && ls.equal(l, w[p]))
+        return p + 1;
+      else
+        return boost::none;
+    }
+
+    template <typename GenSet>
+    boost::optional<size_t>
+    ldivide_at(const wordset<GenSet>&,
+               const typename wordset<GenSet>::value_t& l,
+               const typename wordset<GenSet>::word_t& w, size_t p)
+    {
+      if (l.size() <= w.size() - p
+          && std::equal(begin(l), end(l), begin(w) + p))
+        return p + l.size();
+      else
+        return boost::none;
+    }
+
+    template <typename LabelSet>
+    boost::optional<size_t>
+    ldivide_at(const nullableset<LabelSet>& ls,
+               const typename nullableset<LabelSet>::value_t& l,
+               const typename nullableset<LabelSet>::word_t& w, size_t p)
+    {
+      if (ls.is_one(l))
+        return p;
+      else
+        return ldivide_at(*ls.labelset(), ls.get_value(l), w, p);
+    }
+
+    template <typename... LabelSets, size_t... I>
+    boost::optional<word_position_t<tupleset<LabelSets...>>>
+    ldivide_at_(const tupleset<LabelSets...>& ls,
+                const typename tupleset<LabelSets...>::value_t& l,
+                const typename tupleset<LabelSets...>::word_t& w,
+                const word_position_t<tupleset<LabelSets...>>& p,
+                index_sequence<I...>)
+    {
+      auto res = std::make_tuple(ldivide_at(ls.template set<I>(),
+                                            std::get<I>(l), std::get<I>(w),
+                                            std::get<I>(p))...);
+      if (all(std::get<I>(res)...))
+        return word_position_t<tupleset<LabelSets...>>{*std::get<I>(res)...};
+      else
+        return boost::none;
+    }
+
+    template <typename... LabelSets>
+    boost::optional<word_position_t<tupleset<LabelSets...>>>
+    ldivide_at(const tupleset<LabelSets...>& ls,
+               const typename tupleset<LabelSets...>::value_t& l,
+               const typename tupleset<LabelSets...>::word_t& w,
+               const word_position_t<tupleset<LabelSets...>>& p)
+    {
+      return ldivide_at_(ls, l, w, p,
+                         make_index_sequence<sizeof...(LabelSets)>{});
+    }
+
     /// Evaluate a word on an automaton.
     template <Automaton Aut>
     class evaluator
@@ -41,52 +185,74 @@ namespace vcsn
         : aut_(a)
       {}
 
-      struct labeled_weight
-      {
-        weight_t w;
-        word_t l;
-        state_t s;
-        labeled_weight(weight_t w_, word_t l_, state_t s_)
-        {
-          w = w_;
-          l = l_;
-          s = s_;
-        }
-      };
-
       /// Evaluation of a word.
+      ///
+      /// Labels are matched at offsets in the (delimited) input word,
+      /// instead of computing the remainders, and the weights reaching
+      /// the same state at the same offset are added: this is dynamic
+      /// programming over (state, offset), not an enumeration of the
+      /// paths.  Spontaneous transitions keep the offset: the
+      /// (state, offset) pairs are processed by increasing number of
+      /// letters read, and within one such level, the newly reached
+      /// weights are propagated until the closure is complete.
+      ///
+      /// \pre the automaton has no spontaneous cycles.
       template <typename LabelSet = labelset_t>
       std::enable_if_t<!LabelSet::is_free(),
                       weight_t>
       operator()(const word_t& word) const
       {
-        // Initialization.
-        auto res = ws_.zero();
-
-        // A queue of current word states in the automaton.
-        auto q = std::queue<labeled_weight>{};
-        q.emplace(ws_.one(), wordset_.delimit(word), aut_->pre());
+        using position_t = word_position_t<labelset_t>;
+        using key_t = std::pair<state_t, position_t>;
+        // The weight that remains to be propagated from a key, and
+        // whether the key is in its todo list.
+        struct residual_t
+        {
+          weight_t w;
+          bool queued;
+        };
 
-        while (!q.empty())
+        const auto w = wordset_.delimit(word);
+        auto res = ws_.zero();
+        auto residuals = std::unordered_map<key_t, residual_t>{};
+        // The keys to process, by level (number of letters read).
+        auto todo = std::vector<std::vector<key_t>>(word_level(ls_, w) + 1);
+        auto push = [&](state_t s, const position_t& p, const weight_t& wgt)
           {
-            auto cur = q.front();
-            q.pop();
-
-            for (const auto t : all_out(aut_, cur.s))
-              if (aut_->dst_of(t) == aut_->post() && wordset_.is_special(cur.l))
-                // The word is accepted.
-                {
-                  cur.w = ws_.mul(cur.w, aut_->weight_of(t));
-                  res = ws_.add(res, cur.w);
-                }
-              else if (auto new_word
-                        = wordset_.maybe_ldivide(ls_.word(aut_->label_of(t)), cur.l))
-                q.emplace(
-                    ws_.mul(cur.w, aut_->weight_of(t)),
-                    std::move(*new_word),
-                    aut_->dst_of(t));
-          }
+            auto k = key_t{s, p};
+            auto i = residuals.emplace(k, residual_t{ws_.zero(), false}).first;
+            auto& r = i->second;
+            r.w = ws_.add(r.w, wgt);
+            if (!r.queued)
+              {
+                r.queued = true;
+                todo[position_level(p)].emplace_back(std::move(k));
+              }
+          };
 
+        push(aut_->pre(), position_t{}, ws_.one());
+        for (auto& keys: todo)
+          // Spontaneous transitions append to keys.
+          for (auto i = size_t{0}; i < keys.size(); ++i)
+            {
+              const auto k = keys[i];
+              auto& r = residuals.find(k)->second;
+              r.queued = false;
+              const auto d = r.w;
+              r.w = ws_.zero();
+              if (ws_.is_zero(d))
+                continue;
+              for (const auto t : all_out(aut_, k.first))
+                if (auto p = ldivide_at(ls_, aut_->label_of(t), w, k.second))
+                  {
+                    const auto wgt = ws_.mul(d, aut_->weight_of(t));
+                    // Only the final delimiter leads to post().
+                    if (aut_->dst_of(t) == aut_->post())
+                      res = ws_.add(res, wgt);
+                    else
+                      push(aut_->dst_of(t), *p, wgt);
+                  }
+            }
         return res;
       }
 
@@ -174,6 +340,114 @@ namespace vcsn
       const wps_t wps_ = make_word_polynomialset(aut_->context());
     };
 
+    /// Evaluate words that share prefixes on an automaton with a free
+    /// labelset.
+    ///
+    /// The (sparse) vectors of weights reached after each letter of
+    /// the previous word are kept: the evaluation of the next word
+    /// resumes after their longest common prefix.  Words given in
+    /// lexicographic order are therefore evaluated as a walk in their
+    /// trie, each prefix being evaluated once.
+    template <Automaton Aut>
+    class prefix_evaluator
+    {
+    public:
+      using automaton_t = Aut;
+      using labelset_t = labelset_t_of<automaton_t>;
+      using letter_t = letter_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+      using word_t = word_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = typename weightset_t::value_t;
+
+      /// A delimited word, as a sequence of letters.
+      using letters_t = std::vector<letter_t>;
+
+      static_assert(labelset_t::is_free(),
+                    "prefix_evaluator: requires free labelset");
+
+      prefix_evaluator(const automaton_t& a)
+        : aut_(a)
+        , index_(states_size(aut_), -1)
+        , frontiers_(1)
+      {
+        frontiers_[0].emplace_back(aut_->pre(), ws_.one());
+      }
+
+      /// Evaluation of a word.
+      weight_t operator()(const word_t& word)
+      {
+        word_.clear();
+        word_.emplace_back(ls_.special());
+        for (auto l: ls_.letters_of(word))
+          word_.emplace_back(l);
+        word_.emplace_back(ls_.special());
+        return operator()(word_);
+      }
+
+      /// Evaluation of a delimited word.
+      weight_t operator()(const letters_t& word)
+      {
+        // The length of the common prefix with the previous word.
+        auto prefix = size_t{0};
+        while (prefix < prev_.size() && prefix < word.size()
+               && ls_.equal(prev_[prefix], word[prefix]))
+          ++prefix;
+        prev_.assign(begin(word), end(word));
+
+        if (frontiers_.size() <= word.size())
+          frontiers_.resize(word.size() + 1);
+        for (auto i = prefix; i < word.size(); ++i)
+          step_(frontiers_[i], word[i], frontiers_[i + 1]);
+
+        // After the closing delimiter, only post() can be reached.
+        const auto& last = frontiers_[word.size()];
+        return last.empty() ? ws_.zero() : last.front().second;
+      }
+
+    private:
+      /// A sparse vector of weights.
+      using frontier_t = std::vector<std::pair<state_t, weight_t>>;
+
+      /// Compute in \a to the successors of \a from by \a l.
+      void step_(const frontier_t& from, letter_t l, frontier_t& to)
+      {
+        to.clear();
+        for (const auto& p: from)
+          for (const auto t: out(aut_, p.first, l))
+            {
+              const auto dst = aut_->dst_of(t);
+              if (index_[dst] == -1)
+                {
+                  index_[dst] = to.size();
+                  to.emplace_back(dst, ws_.zero());
+                }
+              auto& w = to[index_[dst]].second;
+              w = ws_.add(w, ws_.mul(p.second, aut_->weight_of(t)));
+            }
+        // Reset the index, and drop the weights that sum to zero.
+        for (const auto& p: to)
+          index_[p.first] = -1;
+        to.erase(std::remove_if(begin(to), end(to),
+                                [this](const auto& p)
+                                {
+                                  return ws_.is_zero(p.second);
+                                }),
+                 end(to));
+      }
+
+      automaton_t aut_;
+      const weightset_t& ws_ = *aut_->weightset();
+      const labelset_t& ls_ = *aut_->labelset();
+      /// state -> its index in the frontier being computed, or -1.
+      std::vector<long> index_;
+      /// The frontiers after each letter of prev_.
+      std::vector<frontier_t> frontiers_;
+      /// The current word.
+      letters_t word_;
+      /// The previous word.
+      letters_t prev_;
+    };
   } // namespace detail
 
   /// General case of evaluation.
@@ -246,30 +520,149 @@ namespace vcsn
     }
   }
 
+  namespace detail
+  {
+    /// Evaluation of a polynomial, sharing the evaluation of the
+    /// common prefixes of its words.
+    ///
+    /// Its monomials are sorted in shortlex order, so consecutive
+    /// words of the same length are in lexicographic order: evaluating
+    /// them in turn walks their trie.
+    template <Automaton Aut, typename Polynomial>
+    auto
+    evaluate_trie(const Aut& a, const Polynomial& p)
+      -> weight_t_of<Aut>
+    {
+      const auto& ws = *a->weightset();
+      auto e = prefix_evaluator<Aut>{a};
+      auto res = ws.zero();
+      for (const auto& m: p)
+        res = ws.add(res, ws.mul(weight_of(m), e(label_of(m))));
+      return res;
+    }
+  }
+
   /// Evaluation of a polynomial.
+  ///
+  /// \param a     the automaton
+  /// \param p     the polynomial of words
+  /// \param algo  how to evaluate its monomials
+  ///   - "monomials": one after the other
+  ///   - "trie": in lexicographic order, sharing the evaluation of
+  ///     their common prefixes.  Requires a free labelset.
+  ///   - "auto": "trie" if the labelset is free, "monomials" otherwise.
   template <Automaton Aut>
   auto
   evaluate(const Aut& a,
-           const typename detail::word_polynomialset_t<context_t_of<Aut>>::value_t& p)
+           const typename detail::word_polynomialset_t<context_t_of<Aut>>::value_t& p,
+           const std::string& algo = "auto")
     -> weight_t_of<Aut>
   {
-    auto e = detail::evaluator<Aut>{a};
-    return e(p);
+    constexpr auto free = labelset_t_of<Aut>::is_free();
+    static const auto map = getarg<bool>
+      {
+        "evaluation algorithm",
+        {
+          {"monomials", false},
+          {"trie",      true},
+        }
+      };
+    if (algo == "auto" ? free : map[algo])
+      return detail::static_if<free>
+        ([](const auto& a, const auto& p)
+         {
+           return detail::evaluate_trie(a, p);
+         },
+         [](const auto& a, const auto&) -> weight_t_of<Aut>
+         {
+           raise("evaluate: trie: requires a free labelset: ",
+                 *a->labelset());
+         })
+        (a, p);
+    else
+      {
+        auto e = detail::evaluator<Aut>{a};
+        return e(p);
+      }
   }
 
+  /// Evaluation of the words of a stream, one per line.
+  ///
+  /// Same as the evaluation of the polynomial they denote, but
+  /// without loading it.  With a free labelset, the evaluation of
+  /// the common prefix of consecutive words is shared: sort the words
+  /// to benefit from it.
+  ///
+  /// \param a       the automaton
+  /// \param is      the stream to read
+  /// \param format  the format of the stream: "words" or "monomials"
+  template <Automaton Aut>
+  auto
+  evaluate(const Aut& a, std::istream& is,
+           const std::string& format = "default")
+    -> weight_t_of<Aut>
+  {
+    static const auto map = getarg<bool>
+      {
+        "evaluate format",
+        {
+          {"monomials", false},
+          {"words",     true},
+        }
+      };
+    const auto words = map[format == "default" ? "monomials" : format];
+    const auto& ws = *a->weightset();
+    auto e = detail::static_if<labelset_t_of<Aut>::is_free()>
+      ([](const auto& a)
+       {
+         return detail::prefix_evaluator<Aut>{a};
+       },
+       [](const auto& a)
+       {
+         return [a](const auto& w) { return evaluate(a, w); };
+       })
+      (a);
+    auto res = ws.zero();
+    if (words)
+      {
+        const auto ls = detail::make_wordset(*a->labelset());
+        auto buf = std::string{};
+        while (getline(is, buf))
+          res = ws.add(res, e(conv(ls, detail::quote(buf))));
+      }
+    else
+      {
+        const auto ps = detail::make_word_polynomialset(a->context());
+        while (auto m = ps.conv_monomial(is))
+          res = ws.add(res, ws.mul(weight_of(*m), e(label_of(*m))));
+      }
+    return res;
+  }
 
   namespace dyn
   {
     namespace detail
     {
       /// Bridge (evaluate).
-      template <Automaton Aut, typename PolynomialSet>
+      template <Automaton Aut, typename PolynomialSet, typename String>
       weight
-      evaluate_polynomial(const automaton& aut, const polynomial& poly)
+      evaluate_polynomial(const automaton& aut, const polynomial& poly,
+                          const std::string& algo)
       {
         const auto& a = aut->as<Aut>();
         const auto& p = poly->as<PolynomialSet>().value();
-        auto res = ::vcsn::evaluate(a, p);
+        auto res = ::vcsn::evaluate(a, p, algo);
+        return {*a->weightset(), res};
+      }
+
+      /// Bridge (evaluate).
+      template <Automaton Aut, typename Istream, typename String>
+      weight
+      evaluate_stream(const automaton& aut, std::istream& is,
+                      const std::string& format)
+      {
+        const auto& a = aut->as<Aut>();
+        auto res = ::vcsn::evaluate(a, is, format);
         return {*a->weightset(), res};
       }
     }
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm> // std::find_if
+#include <unordered_set>
+#include <vector>
+
+#include <vcsn/algos/is-acyclic.hh>
+#include <vcsn/algos/is-deterministic.hh>
+#include <vcsn/core/automaton.hh> // all_out
+#include <vcsn/core/mutable-automaton.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/raise.hh>
+
+namespace vcsn
+{
+  /// A minimal acyclic deterministic automaton, i.e., a finite
+  /// (weighted) language, that can be updated word by word.
+  ///
+  /// Carrasco and Forcada, "Incremental Construction and Maintenance
+  /// of Minimal Finite-State Automata", Computational Linguistics,
+  /// 2002.
+  ///
+  /// All the states but the initial one are kept in a register (a
+  /// hash table of states, indexed by their outgoing transitions and
+  /// final weight), which contains no equivalent states.  To add or
+  /// remove a word, the states along its path are taken out of the
+  /// register, the shared ones (reachable by other words) are cloned,
+  /// and then they are replaced by an equivalent registered state, or
+  /// registered, from the end of the word back to the initial state.
+  /// An update is therefore local: linear in the length of the word,
+  /// not in the size of the automaton.
+  ///
+  /// As in tries, the weights are on the final transitions (e.g.,
+  /// costs in zmin or nmin), and the other weights are one.
+  ///
+  /// \tparam Context  a context with a free labelset.
+  template <typename Context>
+  class lexicon
+  {
+  public:
+    using context_t = Context;
+    using automaton_t = mutable_automaton<context_t>;
+    using labelset_t = labelset_t_of<context_t>;
+    using letter_t = letter_t_of<context_t>;
+    using word_t = word_t_of<context_t>;
+    using weightset_t = weightset_t_of<context_t>;
+    using weight_t = weight_t_of<context_t>;
+    using state_t = state_t_of<automaton_t>;
+
+    static_assert(labelset_t::is_free(),
+                  "lexicon: requires free labelset");
+
+    /// An empty lexicon.
+    lexicon(const context_t& ctx)
+      : aut_(make_mutable_automaton(ctx))
+      , register_(1024, hasher{aut_}, equal{aut_})
+    {
+      initial_ = aut_->new_state();
+      aut_->set_initial(initial_);
+    }
+
+    /// The lexicon of a deterministic acyclic automaton, e.g., from
+    /// `trie` or `dawg`.  \a aut is minimized, and updated in place
+    /// afterwards.
+    ///
+    /// \pre aut is deterministic, acyclic, and its only weights
+    ///      other than one are final weights.
+    lexicon(automaton_t aut)
+      : aut_(aut)
+      , register_(1024, hasher{aut_}, equal{aut_})
+    {
+      const auto& ws = *aut_->weightset();
+      require(is_deterministic(aut_),
+              "lexicon: automaton is not deterministic");
+      require(is_acyclic(aut_),
+              "lexicon: automaton is not acyclic");
+      for (auto t: all_transitions(aut_))
+        require(aut_->dst_of(t) == aut_->post()
+                || ws.is_one(aut_->weight_of(t)),
+                "lexicon: automaton has non final weights");
+      auto inis = initial_transitions(aut_);
+      if (inis.empty())
+        {
+          initial_ = aut_->new_state();
+          aut_->set_initial(initial_);
+        }
+      else
+        initial_ = aut_->dst_of(inis.front());
+      minimize_(initial_);
+    }
+
+    /// The register refers to the automaton, which must not be
+    /// shared.
+    lexicon(const lexicon&) = delete;
+    lexicon(lexicon&&) = default;
+
+    /// The automaton.  Updated in place by add_word and remove_word.
+    const automaton_t& automaton() const
+    {
+      return aut_;
+    }
+
+    /// The weight of \a w, zero if it is not in the lexicon.
+    weight_t weight(const word_t& w) const
+    {
+      auto s = initial_;
+      for (auto l: aut_->labelset()->letters_of(w))
+        {
+          s = delta_(s, l);
+          if (s == aut_->null_state())
+            return aut_->weightset()->zero();
+        }
+      return aut_->get_final_weight(s);
+    }
+
+    /// Add \a w, with weight \a wgt.  If \a w is already in the
+    /// lexicon, \a wgt is added to its weight (e.g., for zmin, the
+    /// smallest cost is kept).
+    void add_word(const word_t& w, const weight_t& wgt = weightset_t::one())
+    {
+      const auto& ws = *aut_->weightset();
+      update_(w, ws.add(weight(w), wgt));
+    }
+
+    /// Remove \a w.
+    /// \returns  whether \a w was in the lexicon.
+    bool remove_word(const word_t& w)
+    {
+      const auto& ws = *aut_->weightset();
+      if (ws.is_zero(weight(w)))
+        return false;
+      update_(w, ws.zero());
+      return true;
+    }
+
+  private:
+    /// Hash a state from its outgoing transitions, regardless of
+    /// their order.
+    struct hasher
+    {
+      size_t operator()(state_t s) const
+      {
+        const auto& ls = *aut_->labelset();
+        const auto& ws = *aut_->weightset();
+        size_t res = 0;
+        for (auto t: all_out(aut_, s))
+          {
+            size_t h = ls.hash(aut_->label_of(t));
+            hash_combine(h, aut_->dst_of(t));
+            hash_combine_hash(h, ws.hash(aut_->weight_of(t)));
+            res += h;
+          }
+        return res;
+      }
+
+      automaton_t aut_;
+    };
+
+    /// Whether two states have the same outgoing transitions.
+    struct equal
+    {
+      bool operator()(state_t s1, state_t s2) const
+      {
+        const auto& ls = *aut_->labelset();
+        const auto& ws = *aut_->weightset();
+        const auto& ts1 = aut_->all_out(s1);
+        const auto& ts2 = aut_->all_out(s2);
+        if (ts1.size() != ts2.size())
+          return false;
+        // The automaton is deterministic.
+        for (auto t1: ts1)
+          {
+            auto l = aut_->label_of(t1);
+            auto i = std::find_if(begin(ts2), end(ts2),
+                                  [&](auto t2)
+                                  {
+                                    return ls.equal(aut_->label_of(t2), l);
+                                  });
+            if (i == end(ts2)
+                || aut_->dst_of(t1) != aut_->dst_of(*i)
+                || !ws.equal(aut_->weight_of(t1), aut_->weight_of(*i)))
+              return false;
+          }
+        return true;
+      }
+
+      automaton_t aut_;
+    };
+
+    /// The successor of \a s by \a l, or null_state.
+    state_t delta_(state_t s, letter_t l) const
+    {
+      for (auto t: out(aut_, s, l))
+        return aut_->dst_of(t);
+      return aut_->null_state();
+    }
+
+    /// Set the weight of \a w to \a wgt, and restore minimality.
+    void update_(const word_t& w, const weight_t& wgt)
+    {
+      letters_.clear();
+      for (auto l: aut_->labelset()->letters_of(w))
+        letters_.emplace_back(l);
+
+      // The longest prefix of w in the automaton.
+      path_.assign(1, initial_);
+      while (path_.size() <= letters_.size())
+        {
+          auto s = delta_(path_.back(), letters_[path_.size() - 1]);
+          if (s == aut_->null_state())
+            break;
+          path_.emplace_back(s);
+        }
+
+      // The states along this prefix are about to change: unregister
+      // them, up to the first state reachable by other words.  From
+      // there on, work on clones, and leave the original states
+      // unchanged, and registered.
+      auto i = size_t{1};
+      for (; i < path_.size() && aut_->all_in(path_[i]).size() == 1; ++i)
+        register_.erase(path_[i]);
+      for (; i < path_.size(); ++i)
+        path_[i] = clone_(path_[i - 1], letters_[i - 1], path_[i]);
+
+      // The rest of the word.
+      while (path_.size() <= letters_.size())
+        {
+          auto s = aut_->new_state();
+          aut_->new_transition(path_.back(), s, letters_[path_.size() - 1]);
+          path_.emplace_back(s);
+        }
+      aut_->set_final(path_.back(), wgt);
+
+      for (auto j = path_.size() - 1; 0 < j; --j)
+        replace_or_register_(path_[j - 1], letters_[j - 1], path_[j]);
+    }
+
+    /// A copy of \a s, instead of s as successor of \a src by \a l.
+    state_t clone_(state_t src, letter_t l, state_t s)
+    {
+      auto res = aut_->new_state();
+      for (auto t: all_out(aut_, s))
+        aut_->new_transition(res, aut_->dst_of(t),
+                             aut_->label_of(t), aut_->weight_of(t));
+      aut_->del_transition(src, s, l);
+      aut_->new_transition(src, res, l);
+      return res;
+    }
+
+    /// State \a s, successor of \a src by \a l, is no longer changed:
+    /// replace it by an equivalent registered state, or register it.
+    /// Delete it if it is useless.
+    void replace_or_register_(state_t src, letter_t l, state_t s)
+    {
+      if (aut_->all_out(s).empty())
+        aut_->del_state(s);
+      else
+        {
+          auto ins = register_.insert(s);
+          if (!ins.second)
+            {
+              aut_->del_state(s);
+              aut_->new_transition(src, *ins.first, l);
+            }
+        }
+    }
+
+    /// Minimize the part of the automaton reachable from \a s, by
+    /// registering the states in post-order, i.e., after their
+    /// successors (Revuz's algorithm, without the height buckets).
+    void minimize_(state_t s)
+    {
+      // Post-order, without recursion.
+      auto todo = std::vector<std::pair<state_t, bool>>{{s, false}};
+      auto seen = std::vector<bool>(detail::states_size(aut_));
+      auto order = std::vector<state_t>{};
+      while (!todo.empty())
+        {
+          auto p = todo.back();
+          todo.pop_back();
+          if (p.second)
+            order.emplace_back(p.first);
+          else if (!seen[p.first])
+            {
+              seen[p.first] = true;
+              todo.emplace_back(p.first, true);
+              for (auto t: out(aut_, p.first))
+                todo.emplace_back(aut_->dst_of(t), false);
+            }
+        }
+      for (auto q: aut_->states())
+        if (!seen[q])
+          aut_->del_state(q);
+      for (auto q: order)
+        if (q != initial_)
+          {
+            if (aut_->all_out(q).empty())
+              aut_->del_state(q);
+            else
+              {
+                auto ins = register_.insert(q);
+                if (!ins.second)
+                  {
+                    // Redirect all the incoming transitions.  Their
+                    // sources are not registered yet.
+                    auto ts = std::vector<transition_t_of<automaton_t>>
+                      (begin(aut_->all_in(q)), end(aut_->all_in(q)));
+                    for (auto t: ts)
+                      aut_->new_transition(aut_->src_of(t), *ins.first,
+                                           aut_->label_of(t));
+                    aut_->del_state(q);
+                  }
+              }
+          }
+    }
+
+    /// The automaton.
+    automaton_t aut_;
+    /// Its initial state.
+    state_t initial_;
+    /// The minimal states, but the initial one.
+    std::unordered_set<state_t, hasher, equal> register_;
+    /// The letters of the word being updated.
+    std::vector<letter_t> letters_;
+    /// The states along it, starting with the initial one.
+    std::vector<state_t> path_;
+  };
+
+  /// An updatable minimal acyclic automaton.
+  template <typename Context>
+  lexicon<Context>
+  make_lexicon(const Context& ctx)
+  {
+    return {ctx};
+  }
+} // vcsn::
@@ -21,12 +21,29 @@ namespace vcsn
     return lightest_path(aut, aut->pre(), aut->post(), tag);
   }
 
+  /// Whether some weight of \a aut is lighter than one.
+  template <Automaton Aut>
+  bool
+  has_lightening_transitions(const Aut& aut)
+  {
+    if (weightset_t_of<Aut>::has_lightening_weights())
+      {
+        const auto& ws = *aut->weightset();
+        for (auto t: all_transitions(aut))
+          if (ws.less(aut->weight_of(t), ws.one()))
+            return true;
+      }
+    return false;
+  }
+
+  /// Bellman-Ford if some weights are lightening (e.g., negative
+  /// weights in zmin), otherwise Dijkstra.
   template <Automaton Aut>
   predecessors_t_of<Aut>
   lightest_path(const Aut& aut, state_t_of<Aut> source, state_t_of<Aut> dest,
                 auto_tag = {})
   {
-    if (weightset_t_of<Aut>::has_lightening_weights())
+    if (has_lightening_transitions(aut))
       return lightest_path(aut, source, dest, bellman_ford_tag{});
     else
       return lightest_path(aut, source, dest, dijkstra_tag{});
@@ -6,6 +6,7 @@
 
 #include <boost/heap/binomial_heap.hpp>
 
+#include <vcsn/algos/detail/path-tree.hh>
 #include <vcsn/algos/lightest-path.hh>
 #include <vcsn/algos/eppstein.hh>
 #include <vcsn/algos/has-lightening-cycle.hh>
@@ -13,6 +14,7 @@
 #include <vcsn/ctx/context.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/fwd.hh>
+#include <vcsn/dyn/lightest-iterator.hh>
 #include <vcsn/dyn/value.hh>
 #include <vcsn/labelset/word-polynomialset.hh>
 
@@ -33,6 +35,8 @@ namespace vcsn
      * This functor will construct the polynomial composed with each one
      * of the `num` smallest paths. This implementation uses a priority
      * queue that will order states by their weights (then labels).
+     * The words are not stored in the queue, but shared in a
+     * path_tree, so that extending a path does not copy its prefix.
      */
     template <Automaton Aut>
     class lightest_impl
@@ -54,7 +58,11 @@ namespace vcsn
       using weight_t = weight_t_of<automaton_t>;
       using state_t = state_t_of<automaton_t>;
 
-      using profile_t = std::tuple<state_t, word_t, weight_t>;
+      /// The words read so far, shared as a tree.
+      using path_tree_t = path_tree<context_t, labelset_t>;
+      using node_t = typename path_tree_t::node_t;
+
+      using profile_t = std::tuple<state_t, node_t, weight_t>;
       struct profile_less
       {
         /// Whether l < r (as this is a max heap).
@@ -73,10 +81,8 @@ namespace vcsn
             return true;
           else if (weightset_t::less(std::get<2>(r), std::get<2>(l)))
             return false;
-          else if (labelset_t::less(std::get<1>(l), std::get<1>(r)))
-            return true;
-          else if (labelset_t::less(std::get<1>(r), std::get<1>(l)))
-            return false;
+          else if (!paths->equal(std::get<1>(l), std::get<1>(r)))
+            return paths->less(std::get<1>(l), std::get<1>(r));
           else if (std::get<0>(r) == automaton_t::element_type::post())
             return true;
           else if (std::get<0>(l) == automaton_t::element_type::post())
@@ -84,6 +90,9 @@ namespace vcsn
           else
             return std::get<0>(l) < std::get<0>(r);
         }
+
+        /// The words of the profiles.
+        const path_tree_t* paths;
       };
       using queue_t =
         boost::heap::binomial_heap<profile_t,
@@ -108,14 +117,15 @@ namespace vcsn
     private:
       polynomial_t lightest_(unsigned num)
       {
-        auto queue = queue_t{};
-        queue.emplace(aut_->pre(), ls_.one(), ws_.one());
+        auto paths = path_tree_t{ls_};
+        auto queue = queue_t{profile_less{&paths}};
+        queue.emplace(aut_->pre(), paths.root(), ws_.one());
 
         // The approximated behavior: the first orders to post's past.
         auto res = ps_.zero();
         while (!queue.empty() && num != res.size())
           {
-            state_t s; word_t l; weight_t w;
+            state_t s; node_t l; weight_t w;
             std::tie(s, l, w) = queue.top();
 
             queue.pop();
@@ -124,11 +134,11 @@ namespace vcsn
             /// weight. Hence, restart loop with sorted queue.
             if (!queue.empty()
                 && std::get<0>(queue.top()) == s
-                && ls_.equal(std::get<1>(queue.top()), l))
+                && paths.equal(std::get<1>(queue.top()), l))
               {
                 while (!queue.empty()
                        && std::get<0>(queue.top()) == s
-                       && ls_.equal(std::get<1>(queue.top()), l))
+                       && paths.equal(std::get<1>(queue.top()), l))
                   {
                     w = ws_.add(w, std::get<2>(queue.top()));
                     queue.pop();
@@ -137,8 +147,10 @@ namespace vcsn
                 continue;
               }
 
+            // Words are materialized only when they are part of the
+            // result.
             if (s == aut_->post())
-              ps_.add_here(res, std::move(l), std::move(w));
+              ps_.add_here(res, paths.word(l), std::move(w));
 
             for (const auto t: all_out(aut_, s))
               {
@@ -147,10 +159,8 @@ namespace vcsn
                 if (aut_->src_of(t) == aut_->pre() || dst == aut_->post())
                   queue.emplace(dst, l, std::move(nw));
                 else
-                  {
-                    auto nl = ls_.mul(l, aut_->label_of(t));
-                    queue.emplace(dst, std::move(nl), std::move(nw));
-                  }
+                  queue.emplace(dst, paths.extend(l, aut_->label_of(t)),
+                                std::move(nw));
               }
           }
 
@@ -158,7 +168,8 @@ namespace vcsn
       }
 
       /// Show the heap, for debugging.
-      void show_heap_(const queue_t& q, std::ostream& os = std::cerr)
+      void show_heap_(const queue_t& q, const path_tree_t& paths,
+                      std::ostream& os = std::cerr)
       {
         const char* sep = "";
         for (auto i = q.ordered_begin(), end = q.ordered_end();
@@ -169,7 +180,7 @@ namespace vcsn
             aut_->print_state_name(std::get<0>(*i), os) << ":<";
             ws_.print(std::get<2>(*i), os);
             os << ">:";
-            ls_.print(std::get<1>(*i), os);
+            ls_.print(paths.word(std::get<1>(*i)), os);
           }
         os << '\n';
       }
@@ -213,6 +224,21 @@ namespace vcsn
           ps.add_here(res, path.make_monomial(ps));
         return res;
       }
+    else if (algo == "lazy-eppstein")
+      {
+        require(is_tropical<weightset_t_of<Aut>>::value,
+                "lightest: lazy-eppstein: invalid weightset: ",
+                *aut->weightset());
+        const auto ps = make_word_polynomialset(aut->context());
+        auto res = ps.zero();
+        detail::lazy_eppstein<Aut> ksp{aut, aut->pre(), aut->post()};
+        for (unsigned i = 0; i < num; ++i)
+          if (auto path = ksp())
+            ps.add_here(res, path->make_monomial(ps));
+          else
+            break;
+        return res;
+      }
     else if ((algo == "auto" && num != 1) || algo == "breadth-first")
       {
         auto lightest = detail::lightest_impl<Aut>{aut};
@@ -245,4 +271,66 @@ namespace vcsn
       }
     }
   }
+
+  /*---------------------------.
+  | lightest_iter(automaton).  |
+  `---------------------------*/
+
+  namespace detail
+  {
+    /// The lightest paths of an automaton, computed on demand.
+    template <Automaton Aut>
+    class lightest_iterator_impl final
+      : public dyn::lightest_iterator::base
+    {
+    public:
+      using automaton_t = Aut;
+      using context_t = context_t_of<automaton_t>;
+      using polynomialset_t = word_polynomialset_t<context_t>;
+
+      lightest_iterator_impl(const automaton_t& aut)
+        : ps_{make_word_polynomialset(aut->context())}
+        , ksp_{aut, aut->pre(), aut->post()}
+      {}
+
+      boost::optional<dyn::polynomial> next() override
+      {
+        if (auto path = ksp_())
+          return dyn::polynomial{ps_,
+                                 typename polynomialset_t::value_t
+                                 {path->make_monomial(ps_)}};
+        else
+          return boost::none;
+      }
+
+    private:
+      const polynomialset_t ps_;
+      lazy_eppstein<automaton_t> ksp_;
+    };
+  }
+
+  /// An enumerator of the paths of \a aut, lightest first.
+  template <Automaton Aut>
+  dyn::lightest_iterator
+  lightest_iter(const Aut& aut)
+  {
+    require(is_tropical<weightset_t_of<Aut>>::value,
+            "lightest_iter: invalid weightset: ", *aut->weightset());
+    return std::make_shared<detail::lightest_iterator_impl<Aut>>(aut);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut>
+      lightest_iterator
+      lightest_iter(const automaton& aut)
+      {
+        const auto& a = aut->as<Aut>();
+        return ::vcsn::lightest_iter(a);
+      }
+    }
+  }
 }
@@ -0,0 +1,778 @@
+#pragma once
+
+#include <algorithm> // lower_bound
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vcsn/algos/positions.hh>
+#include <vcsn/algos/to-expansion.hh>
+#include <vcsn/core/rat/expansionset.hh>
+#include <vcsn/core/rat/expressionset.hh>
+#include <vcsn/core/rat/info.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/matcher.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/labelset/labelset.hh> // law_t
+#include <vcsn/misc/functional.hh> // hash
+#include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/static-if.hh>
+#include <vcsn/weightset/fwd.hh> // b
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*-----------.
+    | lazy_dfa.  |
+    `-----------*/
+
+    /// A deterministic automaton built on the fly from an expression,
+    /// whose states are kept in a cache of bounded size.
+    ///
+    /// The states are the deterministic derived terms of the
+    /// expression (as in `derived_term(e, "expansion,deterministic")`).
+    /// They are computed when first reached, and when the cache is
+    /// full, the least recently used state is evicted.  So the memory
+    /// is bounded even when the deterministic automaton is infinite,
+    /// at the expense of recomputing evicted states.
+    ///
+    /// Transitions keep the expression of their destination, and a
+    /// direct reference to its cache entry, checked by a stamp, which
+    /// spares hashing expressions as long as the destination is not
+    /// evicted.
+    ///
+    /// Requires a letterset: transitions are labeled by letters.
+    template <typename ExpSet>
+    class lazy_dfa
+    {
+    public:
+      using expressionset_t = ExpSet;
+      using expression_t = typename expressionset_t::value_t;
+      using context_t = context_t_of<expressionset_t>;
+      using labelset_t = labelset_t_of<context_t>;
+      using label_t = label_t_of<context_t>;
+      using word_t = typename labelset_t::word_t;
+      using weightset_t = weightset_t_of<context_t>;
+      using weight_t = weight_t_of<context_t>;
+
+      /// A cache entry.
+      using state_t = unsigned;
+
+      /// Not a state.
+      static constexpr state_t null_state()
+      {
+        return std::numeric_limits<state_t>::max();
+      }
+
+      /// The cache of expansions.
+      using cache_t = rat::expansion_cache<expressionset_t>;
+
+      /// \param rs        the expressionset
+      /// \param e         the expression to match
+      /// \param capacity  the maximum number of cached states
+      /// \param cache     if not null, the expansions to reuse, e.g.,
+      ///                  when recomputing evicted states.
+      lazy_dfa(const expressionset_t& rs, const expression_t& e,
+               size_t capacity, std::shared_ptr<cache_t> cache = nullptr)
+        : rs_{rs}
+        , to_expansion_{rs_, std::move(cache)}
+        , capacity_{capacity}
+        , init_{label_t{}, ws_.one(), e}
+      {
+        require(2 <= capacity_,
+                "matcher: capacity must be at least 2: ", capacity_);
+      }
+
+      /// The initial state.
+      ///
+      /// Like all the states returned by this class, it is valid only
+      /// until the next call to `initial` or `step`.
+      state_t initial()
+      {
+        return follow_(null_state(), 0);
+      }
+
+      /// The final weight of \a s.
+      const weight_t& final_weight(state_t s) const
+      {
+        return states_[s].final;
+      }
+
+      /// Follow the transition from \a s labeled by \a l, and
+      /// multiply \a w by its weight.
+      ///
+      /// \returns the destination, or null_state if there is no such
+      ///          transition (then \a w is unchanged).
+      state_t step(state_t s, const label_t& l, weight_t& w)
+      {
+        const auto& out = states_[s].out;
+        auto i = std::lower_bound(begin(out), end(out), l,
+                                  [](const transition& t, const label_t& l)
+                                  {
+                                    return labelset_t::less(t.label, l);
+                                  });
+        if (i == end(out) || !labelset_t::equal(i->label, l))
+          return null_state();
+        else
+          {
+            // follow_ may add a state, and reallocate states_.
+            auto n = size_t(i - begin(out));
+            auto res = follow_(s, n);
+            w = ws_.mul(w, states_[s].out[n].weight);
+            return res;
+          }
+      }
+
+      /// The weight of word \a w.
+      weight_t operator()(const word_t& w)
+      {
+        auto res = ws_.one();
+        auto s = initial();
+        for (const auto& l: labelset_t::letters_of(w))
+          {
+            s = step(s, l, res);
+            if (s == null_state())
+              return ws_.zero();
+          }
+        return ws_.mul(res, final_weight(s));
+      }
+
+      /// The number of cached states.
+      size_t size() const
+      {
+        return index_.size();
+      }
+
+    private:
+      /// A transition, and the cache entry of its destination.
+      struct transition
+      {
+        transition(const label_t& l, const weight_t& w, const expression_t& d)
+          : label{l}
+          , weight{w}
+          , dst{d}
+        {}
+
+        label_t label;
+        weight_t weight;
+        /// The destination.
+        expression_t dst;
+        /// The cache entry of dst, valid if its stamp is unchanged.
+        state_t state = null_state();
+        unsigned stamp = 0;
+      };
+
+      /// A cache entry.
+      struct state
+      {
+        expression_t expression;
+        weight_t final;
+        /// Sorted by label.
+        std::vector<transition> out;
+        /// Incremented each time the entry is recycled.
+        unsigned stamp = 0;
+        /// Neighbors in the LRU list.
+        state_t prev = null_state();
+        state_t next = null_state();
+      };
+
+      /// Transition \a n of \a s, or init_ if \a s is null_state.
+      transition& transition_(state_t s, size_t n)
+      {
+        return s == null_state() ? init_ : states_[s].out[n];
+      }
+
+      /// The destination of transition \a n of \a s (or of init_),
+      /// computed if needed, and marked as most recently used.
+      ///
+      /// Does not keep references on the transition, as insert_ may
+      /// reallocate states_.
+      state_t follow_(state_t s, size_t n)
+      {
+        auto res = transition_(s, n).state;
+        if (res == null_state() || states_[res].stamp != transition_(s, n).stamp)
+          {
+            auto dst = transition_(s, n).dst;
+            auto i = index_.find(dst);
+            res = i == end(index_) ? insert_(dst) : i->second;
+            auto& t = transition_(s, n);
+            t.state = res;
+            t.stamp = states_[res].stamp;
+          }
+        touch_(res);
+        return res;
+      }
+
+      /// Compute the state for \a e, possibly evicting the least
+      /// recently used one.  It is not put in the LRU list.
+      ///
+      /// \pre e is not in the cache.
+      state_t insert_(const expression_t& e)
+      {
+        auto x = es_.determinize(to_expansion_(e));
+        auto res = state_t(states_.size());
+        if (res < capacity_)
+          states_.emplace_back();
+        else
+          {
+            // Evict the least recently used state.
+            res = lru_;
+            unlink_(res);
+            index_.erase(states_[res].expression);
+            states_[res].out.clear();
+            ++states_[res].stamp;
+          }
+        auto& s = states_[res];
+        s.expression = e;
+        s.final = std::move(x.constant);
+        for (const auto& p: x.polynomials)
+          // Deterministic: at most one monomial.
+          for (const auto& m: p.second)
+            if (!rs_.is_zero(label_of(m)) && !ws_.is_zero(weight_of(m)))
+              s.out.emplace_back(p.first, weight_of(m), label_of(m));
+        index_.emplace(e, res);
+        return res;
+      }
+
+      /// Remove \a s from the LRU list.
+      void unlink_(state_t s)
+      {
+        auto& st = states_[s];
+        (st.prev == null_state() ? mru_ : states_[st.prev].next) = st.next;
+        (st.next == null_state() ? lru_ : states_[st.next].prev) = st.prev;
+        st.prev = st.next = null_state();
+      }
+
+      /// Make \a s the most recently used state.
+      void touch_(state_t s)
+      {
+        if (s != mru_)
+          {
+            // Not the most recently used: if listed, it has a prev.
+            if (states_[s].prev != null_state())
+              unlink_(s);
+            states_[s].next = mru_;
+            (mru_ == null_state() ? lru_ : states_[mru_].prev) = s;
+            mru_ = s;
+          }
+      }
+
+      /// The expressionset.
+      expressionset_t rs_;
+      /// Its weightset.
+      weightset_t ws_ = *rs_.weightset();
+      /// The expansionset, to determinize the expansions.
+      using expansionset_t = rat::expansionset<expressionset_t>;
+      expansionset_t es_ = {rs_};
+      /// To compute the expansions.
+      using to_expansion_t = rat::to_expansion_visitor<expressionset_t>;
+      to_expansion_t to_expansion_;
+
+      /// The maximum number of states.
+      size_t capacity_;
+      /// A fake transition to the initial state.
+      transition init_;
+      /// The cached states.
+      std::vector<state> states_;
+      /// Expression to state.
+      std::unordered_map<expression_t, state_t,
+                         vcsn::hash<expressionset_t>,
+                         vcsn::equal_to<expressionset_t>> index_;
+      /// The most and least recently used states.
+      state_t mru_ = null_state();
+      state_t lru_ = null_state();
+    };
+
+    /*----------.
+    | matcher.  |
+    `----------*/
+
+    /// The typed value of the word \a w.
+    template <typename WordSet>
+    typename WordSet::value_t
+    matcher_word(const dyn::label& w)
+    {
+      require(w->vname() == WordSet::sname(),
+              "matcher: invalid word type: ", w->vname(),
+              ", expected: ", WordSet::sname());
+      return w->as<WordSet>().value();
+    }
+
+    /// An expression matcher, as a dyn expression_matcher.
+    ///
+    /// Provides both anchored matching (the weight of a word), and
+    /// search (the weight of a word in `[^]*e[^]*`).
+    template <typename ExpSet>
+    class matcher_impl final
+      : public dyn::expression_matcher::base
+    {
+    public:
+      using expressionset_t = ExpSet;
+      using expression_t = typename expressionset_t::value_t;
+      using context_t = context_t_of<expressionset_t>;
+      using labelset_t = labelset_t_of<context_t>;
+      using wordset_t = law_t<labelset_t>;
+      using word_t = typename wordset_t::value_t;
+      using weightset_t = weightset_t_of<context_t>;
+      using weight_t = weight_t_of<context_t>;
+      using dfa_t = lazy_dfa<expressionset_t>;
+
+      matcher_impl(const expressionset_t& rs, const expression_t& e,
+                   size_t capacity)
+        : rs_{rs}
+        , match_dfa_{rs, e, capacity}
+        , search_dfa_{rs, factors_(rs, e), capacity}
+      {}
+
+      dyn::context context() const override
+      {
+        return rs_.context();
+      }
+
+      dyn::weight match(const dyn::label& w) override
+      {
+        return {ws_, match_dfa_(word_(w))};
+      }
+
+      std::vector<dyn::weight>
+      match(const std::vector<dyn::label>& ws) override
+      {
+        auto res = std::vector<dyn::weight>{};
+        res.reserve(ws.size());
+        for (const auto& w: ws)
+          res.emplace_back(ws_, match_dfa_(word_(w)));
+        return res;
+      }
+
+      dyn::weight search(const dyn::label& w) override
+      {
+        return {ws_, search_(word_(w))};
+      }
+
+      std::vector<dyn::weight>
+      search(const std::vector<dyn::label>& ws) override
+      {
+        auto res = std::vector<dyn::weight>{};
+        res.reserve(ws.size());
+        for (const auto& w: ws)
+          res.emplace_back(ws_, search_(word_(w)));
+        return res;
+      }
+
+      size_t size() const override
+      {
+        return match_dfa_.size() + search_dfa_.size();
+      }
+
+    private:
+      /// The typed value of \a w.
+      word_t word_(const dyn::label& w) const
+      {
+        return matcher_word<wordset_t>(w);
+      }
+
+      /// `[^]*e[^]*`.
+      static expression_t
+      factors_(const expressionset_t& rs, const expression_t& e)
+      {
+        using letter_t = typename labelset_t::letter_t;
+        auto any
+          = rs.star(rs.letter_class(std::set<std::pair<letter_t, letter_t>>{},
+                                    false));
+        return rs.mul(rs.mul(any, e), any);
+      }
+
+      /// The weight of \a w in `[^]*e[^]*`.
+      ///
+      /// Letters that are not in the alphabet cannot be part of a
+      /// match: they split \a w into segments whose weights are
+      /// added.
+      weight_t search_(const word_t& w)
+      {
+        auto res = ws_.zero();
+        auto seg = ws_.one();
+        auto s = search_dfa_.initial();
+        for (const auto& l: labelset_t::letters_of(w))
+          {
+            auto n = search_dfa_.step(s, l, seg);
+            if (n == dfa_t::null_state())
+              {
+                res = ws_.add(res, ws_.mul(seg, search_dfa_.final_weight(s)));
+                seg = ws_.one();
+                s = search_dfa_.initial();
+              }
+            else
+              s = n;
+          }
+        return ws_.add(res, ws_.mul(seg, search_dfa_.final_weight(s)));
+      }
+
+      expressionset_t rs_;
+      weightset_t ws_ = *rs_.weightset();
+      /// For anchored matches.
+      dfa_t match_dfa_;
+      /// For searches.
+      dfa_t search_dfa_;
+    };
+
+    /*-----------------------.
+    | bitparallel_matcher.   |
+    `-----------------------*/
+
+    /// A matcher that simulates the Glushkov automaton of a Boolean
+    /// expression (i.e., `standard`) with bit-parallelism.
+    ///
+    /// Navarro and Raffinot, "Compact DFA Representation for Fast
+    /// Regular Expression Search", WAE 2001.
+    ///
+    /// The set of active states is a bit mask: bit 0 is the initial
+    /// state, and bit p+1 is position p.  In a Glushkov automaton,
+    /// all the transitions into a position have the same label, so
+    /// reading a letter is: the union of the follow sets of the
+    /// active states, restricted to the positions of this letter.
+    /// The unions of follow sets are precomputed for each byte of the
+    /// mask, so a step costs one table lookup per byte.
+    ///
+    /// Requires a Boolean letterset expression, without extended
+    /// operators, and with at most max_positions() atoms.
+    template <typename ExpSet>
+    class bitparallel_matcher_impl final
+      : public dyn::expression_matcher::base
+    {
+    public:
+      using expressionset_t = ExpSet;
+      using expression_t = typename expressionset_t::value_t;
+      using context_t = context_t_of<expressionset_t>;
+      using labelset_t = labelset_t_of<context_t>;
+      using letter_t = typename labelset_t::letter_t;
+      using wordset_t = law_t<labelset_t>;
+      using word_t = typename wordset_t::value_t;
+      using weightset_t = weightset_t_of<context_t>;
+
+      static_assert(std::is_same<weightset_t, b>::value,
+                    "bitparallel matcher: requires a Boolean weightset");
+
+      /// A set of states.
+      using mask_t = std::array<std::uint64_t, 4>;
+
+      /// The maximum number of positions: bit 0 is the initial state.
+      static constexpr unsigned max_positions()
+      {
+        return 64 * std::tuple_size<mask_t>::value - 1;
+      }
+
+      /// \pre e has no extended operators, and at most
+      ///      max_positions() atoms.
+      bitparallel_matcher_impl(const expressionset_t& rs,
+                               const expression_t& e)
+        : rs_{rs}
+      {
+        auto ps = positions(rs_, e);
+        auto size = unsigned(ps.positions.size());
+        require(size <= max_positions(),
+                "matcher: bitparallel: too many positions: ", size);
+        size_ = size;
+        nchunks_ = (size_ + 1 + 7) / 8;
+
+        // The follow set of each state, and the final states.
+        auto follow = std::vector<mask_t>(8 * nchunks_);
+        for (const auto& p: ps.first)
+          set_(follow[0], p.first + 1);
+        if (ps.constant)
+          set_(final_, 0);
+        letters_.emplace_back();
+        for (unsigned p = 0; p < size_; ++p)
+          {
+            const auto& pos = ps.positions[p];
+            for (const auto& q: pos.follow)
+              set_(follow[p + 1], q.first + 1);
+            if (pos.final)
+              set_(final_, p + 1);
+            auto i = index_(pos.label);
+            if (!i)
+              {
+                i = unsigned(letters_.size());
+                letters_.emplace_back();
+                set_index_(pos.label, i);
+              }
+            set_(letters_[i], p + 1);
+          }
+
+        // The union of the follow sets of each byte of a mask.
+        follow_.resize(256 * nchunks_);
+        for (unsigned c = 0; c < nchunks_; ++c)
+          {
+            auto t = begin(follow_) + 256 * c;
+            for (unsigned i = 0; i < 8; ++i)
+              for (unsigned b = 1U << i; b < 2U << i; ++b)
+                t[b] = or_(t[b - (1U << i)], follow[8 * c + i]);
+          }
+      }
+
+      dyn::context context() const override
+      {
+        return rs_.context();
+      }
+
+      dyn::weight match(const dyn::label& w) override
+      {
+        return {ws_, match_(matcher_word<wordset_t>(w))};
+      }
+
+      std::vector<dyn::weight>
+      match(const std::vector<dyn::label>& ws) override
+      {
+        auto res = std::vector<dyn::weight>{};
+        res.reserve(ws.size());
+        for (const auto& w: ws)
+          res.emplace_back(ws_, match_(matcher_word<wordset_t>(w)));
+        return res;
+      }
+
+      dyn::weight search(const dyn::label& w) override
+      {
+        return {ws_, search_(matcher_word<wordset_t>(w))};
+      }
+
+      std::vector<dyn::weight>
+      search(const std::vector<dyn::label>& ws) override
+      {
+        auto res = std::vector<dyn::weight>{};
+        res.reserve(ws.size());
+        for (const auto& w: ws)
+          res.emplace_back(ws_, search_(matcher_word<wordset_t>(w)));
+        return res;
+      }
+
+      /// The number of positions.
+      size_t size() const override
+      {
+        return size_;
+      }
+
+    private:
+      /// Whether \a w matches.
+      bool match_(const word_t& w) const
+      {
+        auto d = mask_t{};
+        set_(d, 0);
+        for (const auto& l: labelset_t::letters_of(w))
+          {
+            auto i = index_(l);
+            if (!i)
+              return false;
+            d = step_(d, i);
+            if (!any_(d))
+              return false;
+          }
+        return any_(and_(d, final_));
+      }
+
+      /// Whether a factor of \a w matches.  The initial state is
+      /// added before each letter, to start a match anywhere.
+      bool search_(const word_t& w) const
+      {
+        if (any_(and_(final_, initial_mask_())))
+          return true;
+        auto d = mask_t{};
+        for (const auto& l: labelset_t::letters_of(w))
+          {
+            set_(d, 0);
+            d = step_(d, index_(l));
+            if (any_(and_(d, final_)))
+              return true;
+          }
+        return false;
+      }
+
+      /// The states reached from \a d by the letter of index \a i.
+      mask_t step_(const mask_t& d, unsigned i) const
+      {
+        auto res = mask_t{};
+        auto t = begin(follow_);
+        for (unsigned c = 0; c < nchunks_; ++c, t += 256)
+          if (auto b = (d[c / 8] >> (c % 8 * 8)) & 0xff)
+            res = or_(res, t[b]);
+        return and_(res, letters_[i]);
+      }
+
+      static mask_t initial_mask_()
+      {
+        auto res = mask_t{};
+        set_(res, 0);
+        return res;
+      }
+
+      static void set_(mask_t& m, unsigned i)
+      {
+        m[i / 64] |= std::uint64_t{1} << (i % 64);
+      }
+
+      static mask_t or_(mask_t l, const mask_t& r)
+      {
+        for (size_t i = 0; i < l.size(); ++i)
+          l[i] |= r[i];
+        return l;
+      }
+
+      static mask_t and_(mask_t l, const mask_t& r)
+      {
+        for (size_t i = 0; i < l.size(); ++i)
+          l[i] &= r[i];
+        return l;
+      }
+
+      static bool any_(const mask_t& m)
+      {
+        for (auto i: m)
+          if (i)
+            return true;
+        return false;
+      }
+
+      /// The index of the mask of \a l, 0 (the empty mask) if \a l
+      /// does not occur in the expression.
+      unsigned index_(char l) const
+      {
+        return char_index_[static_cast<unsigned char>(l)];
+      }
+
+      template <typename Letter>
+      unsigned index_(const Letter& l) const
+      {
+        auto i = index_map_.find(l);
+        return i == end(index_map_) ? 0 : i->second;
+      }
+
+      void set_index_(char l, unsigned i)
+      {
+        char_index_[static_cast<unsigned char>(l)] = i;
+      }
+
+      template <typename Letter>
+      void set_index_(const Letter& l, unsigned i)
+      {
+        index_map_.emplace(l, i);
+      }
+
+      expressionset_t rs_;
+      weightset_t ws_ = *rs_.weightset();
+      /// The number of positions.
+      unsigned size_;
+      /// The number of bytes of the masks that are used.
+      unsigned nchunks_;
+      /// For each byte of a mask, and each of its values, the union
+      /// of the follow sets of its states.
+      std::vector<mask_t> follow_;
+      /// The final states.
+      mask_t final_ = {};
+      /// The positions of each letter, the first one being empty.
+      std::vector<mask_t> letters_;
+      /// The index in letters_ of the letters, when they are chars.
+      std::array<unsigned, 256> char_index_ = {};
+      /// The index in letters_ of the other letters.
+      std::unordered_map<letter_t, unsigned> index_map_;
+    };
+
+    /// The matching algorithms.
+    enum class matcher_algo
+    {
+      bitparallel,
+      deterministic,
+    };
+
+    /// A bit-parallel matcher for \a e if possible, otherwise a
+    /// matcher based on the deterministic derived terms.
+    template <typename ExpSet>
+    dyn::expression_matcher
+    make_bitparallel_matcher(const ExpSet& rs,
+                             const typename ExpSet::value_t& e,
+                             unsigned capacity)
+    {
+      using matcher_t = bitparallel_matcher_impl<ExpSet>;
+      auto i = rat::make_info<ExpSet>(e);
+      if (i.complement || i.compose || i.conjunction || i.infiltrate
+          || i.ldivide || i.shuffle || i.transposition || i.tuple
+          || matcher_t::max_positions() < i.atom)
+        return std::make_shared<matcher_impl<ExpSet>>(rs, e, capacity);
+      else
+        return std::make_shared<matcher_t>(rs, e);
+    }
+  }
+
+  /// A matcher for expression \a e.
+  ///
+  /// \param rs        the expressionset
+  /// \param e         the expression
+  /// \param capacity  the maximum number of cached states (of each
+  ///                  of the anchored and searching automata).
+  /// \param algo      "auto", "bitparallel", or "deterministic".
+  ///                  "bitparallel" requires a Boolean expression,
+  ///                  and falls back to "deterministic" on extended
+  ///                  expressions, or when there are too many atoms.
+  template <typename ExpSet>
+  dyn::expression_matcher
+  matcher(const ExpSet& rs, const typename ExpSet::value_t& e,
+          unsigned capacity = 1024, const std::string& algo = "auto")
+  {
+    using detail::matcher_algo;
+    static const auto map = getarg<matcher_algo>
+      {
+        "matcher algorithm",
+        {
+          {"auto",          "deterministic"},
+          {"bitparallel",   matcher_algo::bitparallel},
+          {"deterministic", matcher_algo::deterministic},
+        }
+      };
+    if (map[algo] == matcher_algo::bitparallel)
+      return detail::static_if<std::is_same<weightset_t_of<ExpSet>, b>::value>
+        ([](const auto& rs, const auto& e, unsigned c)
+           -> dyn::expression_matcher
+         {
+           return detail::make_bitparallel_matcher(rs, e, c);
+         },
+         [](const auto& rs, const auto&, unsigned)
+           -> dyn::expression_matcher
+         {
+           raise("matcher: bitparallel: requires a Boolean weightset: ",
+                 *rs.weightset());
+         })
+        (rs, e, capacity);
+    else
+      return std::make_shared<detail::matcher_impl<ExpSet>>(rs, e, capacity);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <typename ExpSet, typename Unsigned, typename String>
+      expression_matcher
+      matcher(const expression& exp, unsigned capacity,
+              const std::string& algo)
+      {
+        const auto& e = exp->as<ExpSet>();
+        return vcsn::detail::static_if<context_t_of<ExpSet>::is_lal>
+          ([&algo](const auto& rs, const auto& r, unsigned c)
+             -> expression_matcher
+           {
+             return ::vcsn::matcher(rs, r, c, algo);
+           },
+           [](const auto& rs, const auto&, unsigned)
+             -> expression_matcher
+           {
+             raise("matcher: unsupported labelset: ", *rs.labelset());
+           })
+          (e.valueset(), e.value(), capacity);
+      }
+    }
+  }
+}
@@ -9,6 +9,7 @@
 #include <vcsn/algos/quotient.hh>
 #include <vcsn/core/transition-map.hh>
 #include <vcsn/misc/attributes.hh>
+#include <vcsn/misc/portfolio.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/weightset/fwd.hh> // b
 
@@ -159,6 +160,7 @@ namespace vcsn
             go_on = false;
             for (class_t c = 0; c < num_classes_; ++c)
               {
+                portfolio_poll();
                 const set_t& c_states = class_to_set_[c];
                 for (auto l : gs_)
                   {
@@ -9,6 +9,7 @@
 #include <vcsn/misc/dynamic_bitset.hh>
 #include <vcsn/misc/indent.hh>
 #include <vcsn/misc/map.hh> // vcsn::less
+#include <vcsn/misc/portfolio.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/weightset/fwd.hh> // b
 
@@ -231,6 +232,7 @@ namespace vcsn
                  i != end;
                  /* nothing. */)
               {
+                portfolio_poll();
                 auto c = *i;
                 const set_t& c_states = class_to_set_.at(c);
 
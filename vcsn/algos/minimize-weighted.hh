@@ -8,6 +8,7 @@
 #include <vcsn/algos/tags.hh>
 #include <vcsn/algos/accessible.hh> // is_trim
 #include <vcsn/misc/indent.hh>
+#include <vcsn/misc/portfolio.hh>
 #include <vcsn/misc/raise.hh>
 
 namespace vcsn
@@ -201,6 +202,7 @@ namespace vcsn
                  i != end;
                  /* Nothing. */)
               {
+                portfolio_poll();
                 auto c = *i;
                 const set_t& c_states = class_to_set_.at(c);
 
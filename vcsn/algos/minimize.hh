@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vcsn/algos/accessible.hh>
 #include <vcsn/algos/is-deterministic.hh>
 #include <vcsn/algos/is-free-boolean.hh>
 #include <vcsn/algos/minimize-brzozowski.hh>
@@ -10,6 +11,7 @@
 #include <vcsn/algos/tags.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/portfolio.hh>
 #include <vcsn/weightset/fwd.hh> // b
 
 namespace vcsn
@@ -46,6 +48,67 @@ namespace vcsn
     return minimize(a, weighted_tag{});
   }
 
+  /*------------.
+  | portfolio.  |
+  `------------*/
+
+  /// Request to run several minimization algorithms concurrently,
+  /// and keep the first result.
+  struct portfolio_tag {};
+
+  namespace detail
+  {
+    /// The minimization algorithms to run on Boolean automata on a
+    /// free labelset.  Moore fails on non-deterministic automata, but
+    /// signature does not.
+    ///
+    /// Hopcroft is left out: on some incomplete automata, its
+    /// partition is coarser than Moore's.
+    template <Automaton Aut>
+    std::enable_if_t<is_free_boolean<Aut>()>
+    add_minimizers(portfolio<quotient_t<Aut>>& p, const Aut& a)
+    {
+      p.add([&a](const auto&) { return minimize(a, signature_tag{}); });
+      p.add([&a](const auto&) { return minimize(a, moore_tag{}); });
+    }
+
+    /// The minimization algorithms to run on Boolean automata on a
+    /// non-free labelset.
+    template <Automaton Aut>
+    std::enable_if_t<std::is_same<weightset_t_of<Aut>, b>::value
+                     && !labelset_t_of<Aut>::is_free()>
+    add_minimizers(portfolio<quotient_t<Aut>>& p, const Aut& a)
+    {
+      p.add([&a](const auto&) { return minimize(a, signature_tag{}); });
+      p.add([&a](const auto&) { return minimize(a, weighted_tag{}); });
+    }
+
+    /// The minimization algorithms to run on weighted automata.
+    template <Automaton Aut>
+    std::enable_if_t<!std::is_same<weightset_t_of<Aut>, b>::value>
+    add_minimizers(portfolio<quotient_t<Aut>>& p, const Aut& a)
+    {
+      p.add([&a](const auto&) { return minimize(a, weighted_tag{}); });
+    }
+  }
+
+  /// Minimization via a portfolio: run the applicable algorithms
+  /// concurrently, and keep the result of the first one to complete.
+  /// They all compute the same partition, and the states of the
+  /// quotient are sorted, so the result does not depend on the
+  /// winner.
+  template <Automaton Aut>
+  quotient_t<Aut>
+  minimize(const Aut& a, portfolio_tag)
+  {
+    // Complete lazy automata beforehand: the variants must only
+    // read a.
+    accessible_states(a);
+    portfolio<quotient_t<Aut>> p;
+    detail::add_minimizers(p, a);
+    return p.first();
+  }
+
   /// Minimization for Boolean automata on a free labelset: algo
   /// selection.
   ///
@@ -63,6 +126,7 @@ namespace vcsn
         {"auto",      [](const Aut& a){ return minimize(a, auto_tag{}); }},
         {"hopcroft",  [](const Aut& a){ return minimize(a, hopcroft_tag{}); }},
         {"moore",     [](const Aut& a){ return minimize(a, moore_tag{}); }},
+        {"portfolio", [](const Aut& a){ return minimize(a, portfolio_tag{}); }},
         {"signature", [](const Aut& a){ return minimize(a, signature_tag{}); }},
         {"weighted",  [](const Aut& a){ return minimize(a, weighted_tag{}); }},
       }
@@ -88,6 +152,7 @@ namespace vcsn
       "minimization algorithm",
       {
         {"auto",      [](const Aut& a){ return minimize(a, auto_tag{}); }},
+        {"portfolio", [](const Aut& a){ return minimize(a, portfolio_tag{}); }},
         {"signature", [](const Aut& a){ return minimize(a, signature_tag{}); }},
         {"weighted",  [](const Aut& a){ return minimize(a, weighted_tag{}); }},
       }
@@ -109,8 +174,9 @@ namespace vcsn
     {
       "minimization algorithm",
       {
-        {"auto",     [](const Aut& a){ return minimize(a, auto_tag{}); }},
-        {"weighted", [](const Aut& a){ return minimize(a, weighted_tag{}); }},
+        {"auto",      [](const Aut& a){ return minimize(a, auto_tag{}); }},
+        {"portfolio", [](const Aut& a){ return minimize(a, portfolio_tag{}); }},
+        {"weighted",  [](const Aut& a){ return minimize(a, weighted_tag{}); }},
       }
     };
     return map[algo](a);
@@ -165,6 +231,7 @@ namespace vcsn
               {"brzozowski", minimize_tag_<Aut, brzozowski_tag>},
               {"hopcroft",   minimize_tag_<Aut, hopcroft_tag>},
               {"moore",      minimize_tag_<Aut, moore_tag>},
+              {"portfolio",  minimize_tag_<Aut, portfolio_tag>},
               {"signature",  minimize_tag_<Aut, signature_tag>},
               {"weighted",   minimize_tag_<Aut, weighted_tag>},
             }
@@ -203,6 +270,7 @@ namespace vcsn
               {"brzozowski", cominimize_tag_<Aut, brzozowski_tag>},
               {"hopcroft",   cominimize_tag_<Aut, hopcroft_tag>},
               {"moore",      cominimize_tag_<Aut, moore_tag>},
+              {"portfolio",  cominimize_tag_<Aut, portfolio_tag>},
               {"signature",  cominimize_tag_<Aut, signature_tag>},
               {"weighted",   cominimize_tag_<Aut, weighted_tag>},
             }
@@ -0,0 +1,521 @@
+#pragma once
+
+#include <algorithm> // reverse
+#include <deque>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <vcsn/algos/lightest-path.hh> // has_lightening_transitions
+#include <vcsn/core/automaton.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/path-index.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/labelset/word-polynomialset.hh>
+#include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/unordered_map.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/vector.hh> // make_vector
+#include <vcsn/weightset/weightset.hh> // is_tropical
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*------------------.
+    | path_index_impl.  |
+    `------------------*/
+
+    /// Precomputed data to answer many lightest-path queries between
+    /// states of an automaton, which must no longer be modified.
+    ///
+    /// The transitions are stored in compact adjacency arrays, in
+    /// both directions.  A few landmark states are chosen (each one
+    /// the farthest from the previous ones), and their distances from
+    /// and to every state are computed.  Then a query is answered by:
+    ///
+    /// - "alt": A* guided by the landmarks: by the triangle
+    ///   inequality, the distances to/from the landmarks give lower
+    ///   bounds of the distance to the destination;
+    /// - "bidirectional": Dijkstra from both ends, the backward search
+    ///   running on the transposed automaton;
+    /// - "tree": a walk in the reverse shortest path tree of the
+    ///   destination, computed once and cached;
+    /// - "auto": "tree" if the destination was already queried,
+    ///   "alt" otherwise.
+    ///
+    /// Based on `Computing the shortest path: A* search meets graph
+    /// theory`, Goldberg and Harrelson (2005).
+    template <Automaton Aut>
+    class path_index_impl
+    {
+    public:
+      using automaton_t = Aut;
+      using context_t = context_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+      using transition_t = transition_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = weight_t_of<automaton_t>;
+      using polynomialset_t = word_polynomialset_t<context_t>;
+      using polynomial_t = typename polynomialset_t::value_t;
+      /// A path, as a sequence of transitions.
+      using path_t = std::vector<transition_t>;
+
+      /// Build the index.
+      ///
+      /// \param aut        the automaton, which must not be modified
+      ///                   afterwards.
+      /// \param landmarks  the number of landmarks.
+      /// \param trees      the maximum number of cached trees.
+      path_index_impl(const automaton_t& aut, unsigned landmarks,
+                      unsigned trees = 16)
+        : aut_{aut}
+        , ps_{make_word_polynomialset(aut_->context())}
+        , size_{states_size(aut_)}
+        , max_trees_{trees}
+      {
+        require(is_tropical<weightset_t>::value,
+                "path_index: invalid weightset: ", ws_);
+        require(!has_lightening_transitions(aut_),
+                "path_index: lightening weights are not supported");
+        build_arcs_();
+        for (auto d: {0, 1})
+          {
+            dist_[d].resize(size_, ws_.zero());
+            pred_[d].resize(size_, aut_->null_transition());
+          }
+        select_landmarks_(landmarks);
+      }
+
+      /// Not copyable: the index may be large.
+      path_index_impl(const path_index_impl&) = delete;
+
+      /// The lightest path from \a src to \a dst, as a monomial, or
+      /// the empty polynomial if there is none.
+      polynomial_t query(state_t src, state_t dst, const std::string& algo)
+      {
+        auto res = ps_.zero();
+        if (auto p = path(src, dst, algo))
+          {
+            auto l = ps_.labelset()->one();
+            auto w = ws_.one();
+            for (auto t: *p)
+              {
+                if (!aut_->labelset()->is_special(aut_->label_of(t)))
+                  l = ps_.labelset()->mul(l, aut_->label_of(t));
+                w = ws_.mul(w, aut_->weight_of(t));
+              }
+            ps_.add_here(res, l, w);
+          }
+        return res;
+      }
+
+      /// The transitions of a lightest path from \a src to \a dst.
+      boost::optional<path_t>
+      path(state_t src, state_t dst, const std::string& algo)
+      {
+        using query_t = boost::optional<path_t> (path_index_impl::*)
+          (state_t, state_t);
+        static const auto map = getarg<query_t>
+          {
+            "path_index algorithm",
+            {
+              {"alt",           &path_index_impl::alt_},
+              {"auto",          &path_index_impl::auto_},
+              {"bidirectional", &path_index_impl::bidirectional_},
+              {"tree",          &path_index_impl::tree_},
+            }
+          };
+        return (this->*map[algo])(src, dst);
+      }
+
+    private:
+      /// An arc of the adjacency arrays: the other end of a
+      /// transition, its weight, and the transition.
+      struct arc
+      {
+        state_t state;
+        weight_t weight;
+        transition_t transition;
+      };
+
+      /// The arcs, forward (0) and backward (1): the arcs of state s
+      /// are arcs_[d][offsets_[d][s]] to arcs_[d][offsets_[d][s+1]].
+      void build_arcs_()
+      {
+        for (auto d: {0, 1})
+          offsets_[d].assign(size_ + 1, 0);
+        auto ts = transitions(aut_);
+        for (auto t: ts)
+          {
+            ++offsets_[0][aut_->src_of(t) + 1];
+            ++offsets_[1][aut_->dst_of(t) + 1];
+          }
+        for (auto d: {0, 1})
+          {
+            for (size_t s = 0; s < size_; ++s)
+              offsets_[d][s + 1] += offsets_[d][s];
+            arcs_[d].resize(offsets_[d][size_]);
+          }
+        // Where to insert the next arc of each state.
+        std::vector<size_t> next[2] = {offsets_[0], offsets_[1]};
+        for (auto t: ts)
+          {
+            auto src = aut_->src_of(t);
+            auto dst = aut_->dst_of(t);
+            arcs_[0][next[0][src]++] = arc{dst, aut_->weight_of(t), t};
+            arcs_[1][next[1][dst]++] = arc{src, aut_->weight_of(t), t};
+          }
+      }
+
+      /// The distances from (forward) or to (backward) \a root, and
+      /// optionally the shortest path tree.
+      void dijkstra_(state_t root, int dir, std::vector<weight_t>& dist,
+                     std::vector<transition_t>* tree = nullptr)
+      {
+        dist.assign(size_, ws_.zero());
+        if (tree)
+          tree->assign(size_, aut_->null_transition());
+        auto todo = queue_t{};
+        dist[root] = ws_.one();
+        todo.push(entry{ws_.one(), root});
+        while (!todo.empty())
+          {
+            auto e = todo.top();
+            todo.pop();
+            if (ws_.less(dist[e.state], e.key))
+              continue;
+            for (auto i = offsets_[dir][e.state];
+                 i < offsets_[dir][e.state + 1]; ++i)
+              {
+                const auto& a = arcs_[dir][i];
+                auto nd = ws_.mul(e.key, a.weight);
+                if (ws_.less(nd, dist[a.state]))
+                  {
+                    dist[a.state] = nd;
+                    if (tree)
+                      (*tree)[a.state] = a.transition;
+                    todo.push(entry{nd, a.state});
+                  }
+              }
+          }
+      }
+
+      /// Choose \a num landmarks: each one is the farthest from the
+      /// previous ones (unreachable states first).
+      void select_landmarks_(unsigned num)
+      {
+        auto ss = detail::make_vector(aut_->states());
+        // The distance of each state to the closest landmark.
+        auto closest = std::vector<weight_t>(size_, ws_.zero());
+        for (unsigned i = 0; i < num && i < ss.size(); ++i)
+          {
+            auto l = aut_->null_state();
+            for (auto s: ss)
+              if (l == aut_->null_state() || ws_.less(closest[l], closest[s]))
+                l = s;
+            if (ws_.is_one(closest[l]))
+              break;
+            from_.emplace_back();
+            to_.emplace_back();
+            dijkstra_(l, 0, from_.back());
+            dijkstra_(l, 1, to_.back());
+            for (auto s: ss)
+              if (ws_.less(from_.back()[s], closest[s]))
+                closest[s] = from_.back()[s];
+          }
+      }
+
+      /// A lower bound of the distance from \a s to \a dst.
+      weight_t heuristic_(state_t s, state_t dst) const
+      {
+        auto res = ws_.one();
+        // l - r, if it is defined and positive.
+        auto bound = [this, &res](const weight_t& l, const weight_t& r)
+          {
+            if (!ws_.is_zero(l) && !ws_.is_zero(r) && ws_.less(r, l))
+              {
+                auto d = ws_.rdivide(l, r);
+                if (ws_.less(res, d))
+                  res = d;
+              }
+          };
+        for (size_t i = 0; i < from_.size(); ++i)
+          {
+            // d(s, dst) >= d(s, l) - d(dst, l).
+            bound(to_[i][s], to_[i][dst]);
+            // d(s, dst) >= d(l, dst) - d(l, s).
+            bound(from_[i][dst], from_[i][s]);
+          }
+        return res;
+      }
+
+      /// Reset the distances computed by the previous query.
+      void reset_(int dir)
+      {
+        for (auto s: touched_[dir])
+          {
+            dist_[dir][s] = ws_.zero();
+            pred_[dir][s] = aut_->null_transition();
+          }
+        touched_[dir].clear();
+      }
+
+      void set_(int dir, state_t s, const weight_t& w, transition_t t)
+      {
+        if (ws_.is_zero(dist_[dir][s]))
+          touched_[dir].emplace_back(s);
+        dist_[dir][s] = w;
+        pred_[dir][s] = t;
+      }
+
+      /// The path to (forward) or from (backward) \a s, using pred_.
+      path_t path_(int dir, state_t s) const
+      {
+        auto res = path_t{};
+        for (auto t = pred_[dir][s]; t != aut_->null_transition();
+             t = pred_[dir][s])
+          {
+            res.emplace_back(t);
+            s = dir == 0 ? aut_->src_of(t) : aut_->dst_of(t);
+          }
+        if (dir == 0)
+          std::reverse(res.begin(), res.end());
+        return res;
+      }
+
+      boost::optional<path_t> auto_(state_t src, state_t dst)
+      {
+        if (has(trees_, dst) || !queried_.emplace(dst).second)
+          return tree_(src, dst);
+        else
+          return alt_(src, dst);
+      }
+
+      /// A* with the landmark heuristics.
+      boost::optional<path_t> alt_(state_t src, state_t dst)
+      {
+        reset_(0);
+        auto todo = queue_t{};
+        set_(0, src, ws_.one(), aut_->null_transition());
+        todo.push(entry{heuristic_(src, dst), src});
+        while (!todo.empty())
+          {
+            auto e = todo.top();
+            todo.pop();
+            auto s = e.state;
+            if (s == dst)
+              return path_(0, dst);
+            const auto& d = dist_[0][s];
+            // Skip outdated entries.
+            if (ws_.less(ws_.mul(d, heuristic_(s, dst)), e.key))
+              continue;
+            for (auto i = offsets_[0][s]; i < offsets_[0][s + 1]; ++i)
+              {
+                const auto& a = arcs_[0][i];
+                auto nd = ws_.mul(d, a.weight);
+                if (ws_.less(nd, dist_[0][a.state]))
+                  {
+                    set_(0, a.state, nd, a.transition);
+                    todo.push(entry{ws_.mul(nd, heuristic_(a.state, dst)),
+                                    a.state});
+                  }
+              }
+          }
+        return boost::none;
+      }
+
+      /// Dijkstra from both ends.
+      boost::optional<path_t> bidirectional_(state_t src, state_t dst)
+      {
+        if (src == dst)
+          return path_t{};
+        queue_t todo[2];
+        for (auto d: {0, 1})
+          reset_(d);
+        set_(0, src, ws_.one(), aut_->null_transition());
+        set_(1, dst, ws_.one(), aut_->null_transition());
+        todo[0].push(entry{ws_.one(), src});
+        todo[1].push(entry{ws_.one(), dst});
+        // The lightest path found so far, through meet.
+        auto best = ws_.zero();
+        auto meet = aut_->null_state();
+        while (!todo[0].empty() && !todo[1].empty()
+               && ws_.less(ws_.mul(todo[0].top().key, todo[1].top().key),
+                           best))
+          {
+            // Expand the side with the lightest candidate.
+            const int dir = ws_.less(todo[1].top().key, todo[0].top().key);
+            auto e = todo[dir].top();
+            todo[dir].pop();
+            if (ws_.less(dist_[dir][e.state], e.key))
+              continue;
+            for (auto i = offsets_[dir][e.state];
+                 i < offsets_[dir][e.state + 1]; ++i)
+              {
+                const auto& a = arcs_[dir][i];
+                auto nd = ws_.mul(e.key, a.weight);
+                if (ws_.less(nd, dist_[dir][a.state]))
+                  {
+                    set_(dir, a.state, nd, a.transition);
+                    todo[dir].push(entry{nd, a.state});
+                  }
+                const auto& other = dist_[1 - dir][a.state];
+                if (!ws_.is_zero(other))
+                  {
+                    auto w = ws_.mul(dist_[dir][a.state], other);
+                    if (ws_.less(w, best))
+                      {
+                        best = w;
+                        meet = a.state;
+                      }
+                  }
+              }
+          }
+        if (meet == aut_->null_state())
+          return boost::none;
+        auto res = path_(0, meet);
+        auto suffix = path_(1, meet);
+        res.insert(res.end(), suffix.begin(), suffix.end());
+        return res;
+      }
+
+      /// Follow the reverse shortest path tree of \a dst.
+      boost::optional<path_t> tree_(state_t src, state_t dst)
+      {
+        auto i = trees_.find(dst);
+        if (i == trees_.end())
+          {
+            if (max_trees_ <= trees_.size())
+              {
+                trees_.erase(tree_order_.front());
+                tree_order_.pop_front();
+              }
+            i = trees_.emplace(dst, std::vector<transition_t>{}).first;
+            tree_order_.emplace_back(dst);
+            auto dist = std::vector<weight_t>{};
+            dijkstra_(dst, 1, dist, &i->second);
+          }
+        const auto& tree = i->second;
+        if (src != dst && tree[src] == aut_->null_transition())
+          return boost::none;
+        auto res = path_t{};
+        for (auto s = src; s != dst; s = aut_->dst_of(res.back()))
+          res.emplace_back(tree[s]);
+        return res;
+      }
+
+      /// An entry in a priority queue.
+      struct entry
+      {
+        weight_t key;
+        state_t state;
+      };
+
+      struct entry_greater
+      {
+        bool operator()(const entry& l, const entry& r) const
+        {
+          return weightset_t::less(r.key, l.key);
+        }
+      };
+
+      using queue_t
+        = std::priority_queue<entry, std::vector<entry>, entry_greater>;
+
+      /// The automaton.
+      const automaton_t aut_;
+      const weightset_t& ws_ = *aut_->weightset();
+      const polynomialset_t ps_;
+      /// The number of states (including pre and post).
+      const size_t size_;
+      /// Forward (0) and backward (1) adjacency arrays.
+      std::vector<size_t> offsets_[2];
+      std::vector<arc> arcs_[2];
+      /// Distances from each landmark.
+      std::vector<std::vector<weight_t>> from_;
+      /// Distances to each landmark.
+      std::vector<std::vector<weight_t>> to_;
+      /// Per query: forward (0) and backward (1) distances and
+      /// predecessors, and the states that were reached.
+      std::vector<weight_t> dist_[2];
+      std::vector<transition_t> pred_[2];
+      std::vector<state_t> touched_[2];
+      /// Cached reverse shortest path trees, by destination.
+      std::unordered_map<state_t, std::vector<transition_t>> trees_;
+      /// The order in which trees were computed, to evict the oldest.
+      std::deque<state_t> tree_order_;
+      const unsigned max_trees_;
+      /// The destinations already queried.
+      std::unordered_set<state_t> queried_;
+    };
+
+    /// A path index, as a dyn lightest_path_index.
+    template <Automaton Aut>
+    class lightest_path_index_impl final
+      : public dyn::lightest_path_index::base
+    {
+    public:
+      using automaton_t = Aut;
+
+      lightest_path_index_impl(const automaton_t& aut, unsigned landmarks)
+        : index_{aut, landmarks}
+        , aut_{aut}
+      {}
+
+      dyn::polynomial query(unsigned src, unsigned dst,
+                            const std::string& algo) override
+      {
+        auto ps = make_word_polynomialset(aut_->context());
+        return {ps, index_.query(state_(src), state_(dst), algo)};
+      }
+
+    private:
+      /// The state numbered \a s by the user.
+      state_t_of<automaton_t> state_(unsigned s) const
+      {
+        // The user numbers states from 0, after pre and post.
+        auto res = state_t_of<automaton_t>(s + 2);
+        require(s + 2 < states_size(aut_) && aut_->has_state(res),
+                "path_index: invalid state: ", s);
+        return res;
+      }
+
+      path_index_impl<automaton_t> index_;
+      const automaton_t aut_;
+    };
+  }
+
+  /// An index to answer lightest path queries on \a aut.
+  ///
+  /// \param aut        the automaton, which must not be modified
+  ///                   while the index is used.
+  /// \param landmarks  the number of landmarks used by the "alt"
+  ///                   algorithm.
+  template <Automaton Aut>
+  dyn::lightest_path_index
+  path_index(const Aut& aut, unsigned landmarks = 4)
+  {
+    return std::make_shared<detail::lightest_path_index_impl<Aut>>
+      (aut, landmarks);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut, typename Unsigned>
+      lightest_path_index
+      path_index(const automaton& aut, unsigned landmarks)
+      {
+        const auto& a = aut->as<Aut>();
+        return ::vcsn::path_index(a, landmarks);
+      }
+    }
+  }
+}
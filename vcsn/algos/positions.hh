@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <vcsn/core/rat/visitor.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/misc/raise.hh>
+
+namespace vcsn
+{
+  namespace rat
+  {
+    /*-------------.
+    | positions.   |
+    `-------------*/
+
+    /// The positions of an expression, with their continuations.
+    ///
+    /// The continuation of a position is the derived term reached
+    /// once the position is read, as computed by derivation.  The
+    /// derived terms of the expression are the continuations of its
+    /// positions, and the derivative of the continuation of `p` is
+    /// given by `follow` (Lombardy & Sakarovitch, "How Expressions
+    /// Can Code for Automata", 2005).
+    template <typename ExpSet>
+    struct expression_positions
+    {
+      using expressionset_t = ExpSet;
+      using expression_t = typename expressionset_t::value_t;
+      using label_t = label_t_of<expressionset_t>;
+      using weight_t = weight_t_of<expressionset_t>;
+
+      /// Weighted positions: position number -> weight.
+      using set_t = std::vector<std::pair<unsigned, weight_t>>;
+
+      /// A position, i.e., an occurrence of an atom.
+      struct position
+      {
+        /// Its label.
+        label_t label;
+        /// The derived term once the position is read.
+        expression_t continuation;
+        /// The constant term of the continuation.
+        weight_t final;
+        /// The positions that may follow this one, and their weights.
+        set_t follow;
+      };
+
+      /// All the positions, in order of occurrence.
+      std::vector<position> positions;
+      /// The initial positions.
+      set_t first;
+      /// The constant term of the expression.
+      weight_t constant;
+    };
+
+    /// A functor to compute the positions of an expression.
+    ///
+    /// \tparam ExpSet  the expressionset type.
+    template <typename ExpSet>
+    class positions_visitor
+      : public ExpSet::const_visitor
+    {
+    public:
+      using expressionset_t = ExpSet;
+      using super_t = typename expressionset_t::const_visitor;
+      using self_t = positions_visitor;
+
+      using expression_t = typename expressionset_t::value_t;
+      using weightset_t = weightset_t_of<expressionset_t>;
+      using weight_t = typename weightset_t::value_t;
+
+      using positions_t = expression_positions<expressionset_t>;
+      using set_t = typename positions_t::set_t;
+
+      /// Name of this algorithm, for error messages.
+      constexpr static const char* me() { return "positions"; }
+
+      positions_visitor(const expressionset_t& rs)
+        : rs_{rs}
+      {}
+
+      positions_t operator()(const expression_t& v)
+      {
+        res_ = positions_t{};
+        v->accept(*this);
+        for (const auto& p: last_)
+          res_.positions[p.first].final = p.second;
+        res_.first = std::move(first_);
+        res_.constant = std::move(constant_);
+        return std::move(res_);
+      }
+
+    private:
+      VCSN_RAT_UNSUPPORTED(complement)
+      VCSN_RAT_UNSUPPORTED(compose)
+      VCSN_RAT_UNSUPPORTED(conjunction)
+      VCSN_RAT_UNSUPPORTED(infiltrate)
+      VCSN_RAT_UNSUPPORTED(ldivide)
+      VCSN_RAT_UNSUPPORTED(shuffle)
+      VCSN_RAT_UNSUPPORTED(transposition)
+
+      using tuple_t = typename super_t::tuple_t;
+      void visit(const tuple_t& e, std::true_type) override
+      {
+        raise(me(), ": operator tuple not supported: ",
+              to_string(rs_, e.shared_from_this()));
+      }
+
+      VCSN_RAT_VISIT(zero,)
+      {
+        first_.clear();
+        last_.clear();
+        constant_ = ws_.zero();
+      }
+
+      VCSN_RAT_VISIT(one,)
+      {
+        first_.clear();
+        last_.clear();
+        constant_ = ws_.one();
+      }
+
+      VCSN_RAT_VISIT(atom, e)
+      {
+        auto p = unsigned(res_.positions.size());
+        res_.positions.push_back({e.value(), continuation_(),
+                                  ws_.zero(), {}});
+        first_ = {{p, ws_.one()}};
+        last_ = {{p, ws_.one()}};
+        constant_ = ws_.zero();
+      }
+
+      VCSN_RAT_VISIT(name, e)
+      {
+        super_t::visit(e);
+      }
+
+      VCSN_RAT_VISIT(add, e)
+      {
+        auto first = set_t{};
+        auto last = set_t{};
+        auto constant = ws_.zero();
+        for (const auto& v: e)
+          {
+            v->accept(*this);
+            append_(first, first_);
+            append_(last, last_);
+            constant = ws_.add(constant, constant_);
+          }
+        first_ = std::move(first);
+        last_ = std::move(last);
+        constant_ = std::move(constant);
+      }
+
+      VCSN_RAT_VISIT(mul, e)
+      {
+        auto n = e.size();
+        auto firsts = std::vector<set_t>{};
+        auto lasts = std::vector<set_t>{};
+        auto constants = std::vector<weight_t>{};
+        for (unsigned i = 0; i < n; ++i)
+          {
+            // The positions of the i-th factor are followed by the
+            // remaining factors, as in derivation.
+            continuations_.push_back({rs_.mul_range(std::next(e.begin(),
+                                                              i + 1),
+                                                    std::end(e)),
+                                      ws_.one()});
+            e[i]->accept(*this);
+            continuations_.pop_back();
+            firsts.emplace_back(std::move(first_));
+            lasts.emplace_back(std::move(last_));
+            constants.emplace_back(std::move(constant_));
+          }
+
+        // From right to left, the first positions of the factors
+        // after i, which follow the last positions of the i-th
+        // factor.  Once done, this is the first positions of e.
+        auto first = set_t{};
+        // The product of the constant terms of the factors after i.
+        auto constant = ws_.one();
+        auto last = set_t{};
+        for (unsigned i = n; i-- > 0; )
+          {
+            for (const auto& p: lasts[i])
+              {
+                follow_(p.first, p.second, first);
+                auto w = ws_.mul(p.second, constant);
+                if (!ws_.is_zero(w))
+                  last.emplace_back(p.first, std::move(w));
+              }
+            first = lweight_(constants[i], std::move(first));
+            first.insert(std::begin(first),
+                         std::begin(firsts[i]), std::end(firsts[i]));
+            constant = ws_.mul(constants[i], constant);
+          }
+        first_ = std::move(first);
+        last_ = std::move(last);
+        constant_ = std::move(constant);
+      }
+
+      VCSN_RAT_VISIT(star, e)
+      {
+        continuations_.push_back({e.shared_from_this(), ws_.one()});
+        e.sub()->accept(*this);
+        continuations_.pop_back();
+        constant_ = ws_.star(constant_);
+        first_ = lweight_(constant_, std::move(first_));
+        for (auto& p: last_)
+          {
+            follow_(p.first, p.second, first_);
+            p.second = ws_.mul(p.second, constant_);
+          }
+        last_ = prune_(std::move(last_));
+      }
+
+      VCSN_RAT_VISIT(lweight, e)
+      {
+        e.sub()->accept(*this);
+        first_ = lweight_(e.weight(), std::move(first_));
+        constant_ = ws_.mul(e.weight(), constant_);
+      }
+
+      VCSN_RAT_VISIT(rweight, e)
+      {
+        continuations_.push_back({nullptr, e.weight()});
+        e.sub()->accept(*this);
+        continuations_.pop_back();
+        if (ws_.is_zero(e.weight()))
+          first_.clear();
+        for (auto& p: last_)
+          p.second = ws_.mul(p.second, e.weight());
+        last_ = prune_(std::move(last_));
+        constant_ = ws_.mul(constant_, e.weight());
+      }
+
+      /// The continuation of the current atom: apply the enclosing
+      /// contexts, innermost first.
+      expression_t continuation_() const
+      {
+        auto res = rs_.one();
+        for (auto i = continuations_.rbegin(); i != continuations_.rend(); ++i)
+          res = i->first ? rs_.mul(res, i->first) : rs_.rweight(res, i->second);
+        return res;
+      }
+
+      /// Add to the follow set of \a p the positions of \a s, weighted
+      /// on the left by \a w.
+      void follow_(unsigned p, const weight_t& w, const set_t& s)
+      {
+        auto& f = res_.positions[p].follow;
+        for (const auto& q: s)
+          {
+            auto v = ws_.mul(w, q.second);
+            if (!ws_.is_zero(v))
+              f.emplace_back(q.first, std::move(v));
+          }
+      }
+
+      /// Left-multiply the weights of \a s by \a w.
+      set_t lweight_(const weight_t& w, set_t s) const
+      {
+        if (ws_.is_zero(w))
+          s.clear();
+        else if (!ws_.is_one(w))
+          {
+            for (auto& p: s)
+              p.second = ws_.mul(w, p.second);
+            s = prune_(std::move(s));
+          }
+        return s;
+      }
+
+      /// Remove the positions with a null weight.
+      set_t prune_(set_t s) const
+      {
+        s.erase(std::remove_if(std::begin(s), std::end(s),
+                               [this](const auto& p)
+                               {
+                                 return ws_.is_zero(p.second);
+                               }),
+                std::end(s));
+        return s;
+      }
+
+      /// Append \a s to \a res.
+      static void append_(set_t& res, const set_t& s)
+      {
+        res.insert(std::end(res), std::begin(s), std::end(s));
+      }
+
+      /// The expressionset.
+      expressionset_t rs_;
+      /// Its weightset.
+      weightset_t ws_ = *rs_.weightset();
+      /// The result.
+      positions_t res_;
+      /// The first positions of the current node.
+      set_t first_;
+      /// The last positions of the current node, and their constant
+      /// terms.
+      set_t last_;
+      /// The constant term of the current node.
+      weight_t constant_;
+      /// The enclosing contexts of the current node, outermost first:
+      /// either a right product by an expression, or (when null) a
+      /// right weight.
+      std::vector<std::pair<expression_t, weight_t>> continuations_;
+    };
+  }
+
+  /// The positions of \a e.
+  template <typename ExpSet>
+  rat::expression_positions<ExpSet>
+  positions(const ExpSet& rs, const typename ExpSet::value_t& e)
+  {
+    auto v = rat::positions_visitor<ExpSet>{rs};
+    return v(e);
+  }
+}
@@ -3,7 +3,7 @@
 #include <vcsn/algos/distance.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/fwd.hh>
-#include <vcsn/misc/unordered_map.hh>
+#include <vcsn/misc/direction.hh>
 
 namespace vcsn
 {
@@ -21,19 +21,17 @@ namespace vcsn
     return d[aut->post()];
   }
 
-  /// Find all shortest distances of each state
-  /// to the final states of \a aut.
+  /// Find all shortest distances of each state to the final states
+  /// of \a aut, indexed by state.
+  ///
+  /// A single backward search from post, instead of one search per
+  /// state.
   template <Automaton Aut>
-  std::unordered_map<state_t_of<Aut>, weight_t_of<Aut>>
+  std::vector<weight_t_of<Aut>>
   shortest_distance_to_finals(Aut aut)
   {
-    std::unordered_map<state_t_of<Aut>, weight_t_of<Aut>> res;
-    for (auto s : aut->states())
-      {
-        auto w = shortest_distance_to_finals(aut, s);
-        res.emplace(s, w);
-      }
-    return res;
+    auto sd = detail::shortest_distance_impl<Aut, direction::backward>{aut};
+    return sd(aut->post());
   }
 
   /// The algorithm weight pushing.
@@ -47,11 +45,10 @@ namespace vcsn
     auto res = ::vcsn::copy(aut);
     auto distances = shortest_distance_to_finals(res);
     auto ws = *res->weightset();
-    distances[res->post()] = ws.one();
     for (auto t : all_transitions(res))
       {
-        auto ds = distances[res->src_of(t)];
-        auto de = distances[res->dst_of(t)];
+        const auto& ds = distances[res->src_of(t)];
+        const auto& de = distances[res->dst_of(t)];
         auto w = ws.mul(res->weight_of(t), de);
         if (res->src_of(t) == res->pre())
           res->set_weight(t, de);
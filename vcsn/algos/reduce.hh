@@ -9,8 +9,10 @@
 #include <vcsn/core/automaton.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/qh.hh>
 #include <vcsn/weightset/r.hh>
 #include <vcsn/weightset/z.hh>
+#include <vcsn/weightset/zh.hh>
 
 namespace vcsn
 {
@@ -136,6 +138,10 @@ namespace vcsn
       }
     };
 
+    template <>
+    struct select<qh> : select<q>
+    {};
+
     template <>
     struct select<r> : select<void>
     {
@@ -185,6 +191,10 @@ namespace vcsn
       }
     };
 
+    template <>
+    struct select<zh> : select<z>
+    {};
+
     template <Automaton Aut>
     class left_reductioner
     {
@@ -200,7 +210,14 @@ namespace vcsn
       using output_state_t = state_t_of<output_automaton_t>;
       using weight_t = typename context_t::weight_t;
       using vector_t = std::vector<weight_t>;
-      using matrix_t = std::vector<std::map<std::size_t, weight_t>>;
+      /// A sparse matrix, in compressed sparse row format: the
+      /// entries (column, weight) of row i are entries[begin[i]] to
+      /// entries[begin[i+1]] excluded.
+      struct matrix_t
+      {
+        std::vector<unsigned> begin;
+        std::vector<std::pair<unsigned, weight_t>> entries;
+      };
       using matrix_set_t = std::map<label_t, matrix_t>;
 
     public:
@@ -227,16 +244,22 @@ namespace vcsn
         // Computation of the final_ vector.
         for (auto t : final_transitions(input_))
           final_[state_to_index[input_->src_of(t)]] = input_->weight_of(t);
-        // For each letter, we define an adjency matrix.
-        for (auto t : transitions(input_))
+        // For each letter, we define an adjacency matrix.  Rows are
+        // filled in order, since we visit the states in index order.
+        i = 0;
+        for (auto s: input_->states())
           {
-            auto it = letter_matrix_set_.find(input_->label_of(t));
-            if (it == letter_matrix_set_.end())
-              it = letter_matrix_set_.emplace(input_->label_of(t),
-                                             matrix_t(dimension_)).first;
-            it->second[state_to_index[input_->src_of(t)]]
-              [state_to_index[input_->dst_of(t)]] = input_->weight_of(t);
+            for (auto t : out(input_, s))
+              {
+                auto& m = letter_matrix_set_[input_->label_of(t)];
+                m.begin.resize(i + 1, m.entries.size());
+                m.entries.emplace_back(state_to_index[input_->dst_of(t)],
+                                       input_->weight_of(t));
+              }
+            ++i;
           }
+        for (auto& m: letter_matrix_set_)
+          m.second.begin.resize(dimension_ + 1, m.second.entries.size());
       }
 
       //utility methods
@@ -247,11 +270,12 @@ namespace vcsn
                                  vector_t& res)
       {
         for (unsigned i = 0; i < dimension_; i++)
-          for (auto it : m[i])
-            {
-              unsigned j = it.first;
-              res[j] = ws_.add(res[j], ws_.mul(v[i], it.second));
-            }
+          if (!ws_.is_zero(v[i]))
+            for (unsigned e = m.begin[i]; e < m.begin[i + 1]; ++e)
+              {
+                unsigned j = m.entries[e].first;
+                res[j] = ws_.add(res[j], ws_.mul(v[i], m.entries[e].second));
+              }
       }
 
       /// Computes the scalar product of two vectors.
@@ -260,13 +284,30 @@ namespace vcsn
       {
         weight_t res = ws_.zero();
         for (unsigned i = 0; i < dimension_; ++i)
-          res = ws_.add(res, ws_.mul(v[i], w[i]));
+          if (!ws_.is_zero(v[i]))
+            res = ws_.add(res, ws_.mul(v[i], w[i]));
         return res;
       }
 
+      /// Compute the support of \a v, the \a b-th vector of the
+      /// basis, without its pivot.
+      void update_support(unsigned b, const vector_t& v,
+                          const unsigned* permutation)
+      {
+        if (supports_.size() <= b)
+          supports_.resize(b + 1);
+        auto& support = supports_[b];
+        support.clear();
+        for (unsigned i = 0; i < dimension_; ++i)
+          if (i != permutation[b] && !ws_.is_zero(v[i]))
+            support.push_back(i);
+      }
+
       ///  Specializations for Q and R.
       using z_weight_t = vcsn::detail::z_impl::value_t; // int or long
+      using zh_weight_t = vcsn::detail::zh_impl::value_t;
       using q_weight_t = vcsn::detail::q_impl::value_t;
+      using qh_weight_t = vcsn::detail::qh_impl::value_t;
       using r_weight_t = vcsn::detail::r_impl::value_t; // = double
 
       /*
@@ -284,6 +325,11 @@ namespace vcsn
         return w.den+abs(w.num);
       }
 
+      static weight_t norm(const qh_weight_t& w)
+      {
+        return w.get_den() + abs(w.get_num());
+      }
+
       /// Norm for real numbers; a "stable" pivot should minimize this norm.
       static weight_t norm(const r_weight_t& w)
       {
@@ -296,6 +342,11 @@ namespace vcsn
         return abs(w);
       }
 
+      static weight_t norm(const zh_weight_t& w)
+      {
+        return abs(w);
+      }
+
       // Works for both Q and R.
       unsigned
       find_pivot_by_norm(const vector_t& v, unsigned begin,
@@ -321,10 +372,11 @@ namespace vcsn
 
       // Gcd function that also computes the Bezout coefficients.
       // Used in the z reduction.
-      static z_weight_t
-      gcd(z_weight_t x, z_weight_t y, z_weight_t& a, z_weight_t& b)
+      template <typename Int>
+      static Int
+      gcd(Int x, Int y, Int& a, Int& b)
       {
-        z_weight_t res = 0;
+        Int res = 0;
         //gcd = ax + by
         if (y == 0)
           {
@@ -346,7 +398,7 @@ namespace vcsn
           res = gcd(y, x, b, a);
         else
           {
-            z_weight_t z = x % y;  // z= x- (x/y)*y;
+            Int z = x % y;  // z= x- (x/y)*y;
             res = gcd(y, z, b, a);
             //res=by+az = (b-a(x/y)) y + ax
             b -= a * (x / y);
@@ -437,10 +489,10 @@ namespace vcsn
           return ratio;
         // This is safer than current[p] = current[p]-ratio*vbasis[p];
         current[pivot] = ws_.zero();
-        for (unsigned i = b+1; i < dimension_; ++i)
-          current[permutation[i]]
-            = ws_.sub(current[permutation[i]],
-                      ws_.mul(ratio, vbasis[permutation[i]]));
+        // Entries of vbasis before its pivot are zero: visit only its
+        // support.
+        for (auto i: supports_[b])
+          current[i] = ws_.sub(current[i], ws_.mul(ratio, vbasis[i]));
         return ratio;
       }
 
@@ -463,8 +515,13 @@ namespace vcsn
                                unsigned* permutation)
       {
         for (unsigned b = basis.size()-1; 0 < b; --b)
-          for (unsigned c = 0; c < b; ++c)
-            reduce_vector(basis[b], basis[c], b, permutation);
+          {
+            // basis[b] was modified by the previous iterations.
+            update_support(b, basis[b], permutation);
+            for (unsigned c = 0; c < b; ++c)
+              reduce_vector(basis[b], basis[c], b, permutation);
+          }
+        update_support(0, basis[0], permutation);
       }
 
       /// Compute the coordinate of a vector in the new basis.
@@ -479,32 +536,26 @@ namespace vcsn
       /** Core algorithm
           This algorithm computes a basis of I.mu(w).
           The basis is scaled.
-
-          An automaton where states correspond to the vectors of
-          this basis is built
        */
-    public:
-      output_automaton_t operator()()
+      void make_basis()
       {
         // Used to select the proper overload depending on weightset_t.
         using type_t = select<weightset_t>;
 
         linear_representation();
-        // The basis is a list of vectors, each vector is associated with
-        // a state of the output
-        auto basis = std::vector<vector_t>{};
         // The permutation array corresponds to a permutation of the indices
         // (i.e. the columns of the matrices) such that permtuation[k]
         // is the pivot of the k-th vector of the basis.
-        unsigned permutation[dimension_];
+        permutation_.resize(dimension_);
         for (unsigned i = 0; i < dimension_; ++i)
-          permutation[i] = i;
+          permutation_[i] = i;
+        auto permutation = permutation_.data();
         // If the initial vector is null, the function immediatly returns
 
         // A non zero entry is chosen as pivot
         unsigned pivot = type_t::find_pivot(this, init_, 0, permutation);
         if (pivot == dimension_) //all components of init_ are 0
-          return res_;
+          return;
         // The pivot of the first basis vector is permutation[0];
         permutation[0] = pivot;
         permutation[pivot] = 0;
@@ -512,34 +563,66 @@ namespace vcsn
         // (up to the normalisation w.r.t the pivot)
         auto first = vector_t(init_);
         type_t::normalisation_vector(this, first, 0, permutation);
-        basis.push_back(first);
+        update_support(0, first, permutation);
+        basis_.push_back(first);
         // To each vector of the basis, all the successor vectors are
         // computed, reduced to respect to the basis, and finally, if
         // linearly independant, pushed at the end of the basis
         // itself.
-        for (unsigned nb = 0; nb < basis.size(); ++nb)
+        for (unsigned nb = 0; nb < basis_.size(); ++nb)
           // All the vectors basis[nb].mu(a) are processed
-          for (auto mu : letter_matrix_set_) //mu is a pair (letter,matrix)
+          for (const auto& mu : letter_matrix_set_) //mu is a pair (letter,matrix)
             {
               auto current = vector_t(dimension_);
-              product_vector_matrix(basis[nb], mu.second, current);
+              product_vector_matrix(basis_[nb], mu.second, current);
               //reduction of current w.r.t each basis vector;
-              for (unsigned b = 0; b < basis.size(); ++b)
-                type_t::reduce_vector(this, basis[b],
+              for (unsigned b = 0; b < basis_.size(); ++b)
+                type_t::reduce_vector(this, basis_[b],
                                       current, b, permutation);
               // After reduction, we put current in the basis if it is
               // not null and we search for the pivot of current.
-              pivot = type_t::find_pivot(this, current, basis.size(),
+              pivot = type_t::find_pivot(this, current, basis_.size(),
                                          permutation);
               if (pivot != dimension_) //otherwise, current is null
                 {
-                  if (pivot != basis.size())
-                    std::swap(permutation[pivot], permutation[basis.size()]);
+                  if (pivot != basis_.size())
+                    std::swap(permutation[pivot], permutation[basis_.size()]);
                   type_t::normalisation_vector(this, current,
-                                               basis.size(), permutation);
-                  basis.push_back(current);
+                                               basis_.size(), permutation);
+                  update_support(basis_.size(), current, permutation);
+                  basis_.push_back(std::move(current));
                 }
             }
+      }
+
+    public:
+      /// Whether the series of the input is zero, i.e., whether the
+      /// final vector is orthogonal to I.mu(w) for all w.
+      ///
+      /// Cheaper than checking whether the reduced automaton is
+      /// empty: this requires neither the transposition nor the
+      /// construction of the output automaton.
+      bool is_zero_series()
+      {
+        make_basis();
+        for (const auto& v: basis_)
+          if (!ws_.is_zero(scalar_product(v, final_)))
+            return false;
+        return true;
+      }
+
+      /// An automaton where states correspond to the vectors of the
+      /// basis.
+      output_automaton_t operator()()
+      {
+        // Used to select the proper overload depending on weightset_t.
+        using type_t = select<weightset_t>;
+
+        make_basis();
+        if (basis_.empty())
+          return res_;
+        auto& basis = basis_;
+        auto permutation = permutation_.data();
 
         // now, we use each vector to reduce the preceding vectors in
         // the basis.  If weightset=Z we do not do it.
@@ -563,7 +646,7 @@ namespace vcsn
             weight_t k = scalar_product(basis[v],final_);
             if(!ws_.is_zero(k))
               res_->set_final(states[v],k);
-            for (auto mu : letter_matrix_set_)
+            for (const auto& mu : letter_matrix_set_)
               {
                 // mu is a pair (letter,matrix).
                 auto current = vector_t(dimension_);
@@ -589,6 +672,15 @@ namespace vcsn
       vector_t init_;
       vector_t final_;
       matrix_set_t letter_matrix_set_;
+
+      /// The basis: a list of vectors, each vector is associated
+      /// with a state of the output.
+      std::vector<vector_t> basis_;
+      /// For each vector of the basis, the indexes of its non-zero
+      /// entries, but its pivot.  Not maintained for Z.
+      std::vector<std::vector<unsigned>> supports_;
+      /// permutation_[k] is the pivot of the k-th vector of the basis.
+      std::vector<unsigned> permutation_;
     };
 
   }
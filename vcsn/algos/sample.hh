@@ -0,0 +1,529 @@
+#pragma once
+
+#include <algorithm> // max, upper_bound
+#include <cmath> // abs, exp, isfinite
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <cstddef> // https://gcc.gnu.org/gcc-4.9/porting_to.html
+#include <gmpxx.h>
+
+#include <vcsn/algos/determinize.hh>
+#include <vcsn/algos/is-deterministic.hh>
+#include <vcsn/algos/scc.hh>
+#include <vcsn/core/automaton.hh> // all_out
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/labelset/labelset.hh> // make_wordset
+#include <vcsn/misc/random.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/static-if.hh>
+#include <vcsn/weightset/fwd.hh> // b
+#include <vcsn/weightset/log.hh>
+#include <vcsn/weightset/r.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*--------------.
+    | alias_table.  |
+    `--------------*/
+
+    /// A discrete distribution drawn in constant time.
+    ///
+    /// Vose, "A Linear Algorithm for Generating Random Numbers with a
+    /// Given Distribution", IEEE Transactions on Software Engineering,
+    /// 1991.
+    ///
+    /// Each of the n cells holds the probability to keep its own
+    /// index, and an alias for the other case.  A draw picks a cell
+    /// uniformly, and then either its index or its alias.
+    class alias_table
+    {
+    public:
+      alias_table() = default;
+
+      /// \param ws  non-negative weights, not all null.
+      alias_table(const std::vector<double>& ws)
+        : prob_(ws.size())
+        , alias_(ws.size())
+      {
+        auto n = ws.size();
+        auto sum = 0.0;
+        for (auto w: ws)
+          sum += w;
+        auto small = std::vector<unsigned>{};
+        auto large = std::vector<unsigned>{};
+        for (unsigned i = 0; i < n; ++i)
+          {
+            prob_[i] = ws[i] * n / sum;
+            (prob_[i] < 1 ? small : large).emplace_back(i);
+          }
+        while (!small.empty() && !large.empty())
+          {
+            auto s = small.back();
+            small.pop_back();
+            auto l = large.back();
+            alias_[s] = l;
+            prob_[l] -= 1 - prob_[s];
+            if (prob_[l] < 1)
+              {
+                large.pop_back();
+                small.emplace_back(l);
+              }
+          }
+        // Rounding errors: the remaining cells are full.
+        for (auto i: small)
+          prob_[i] = 1;
+        for (auto i: large)
+          prob_[i] = 1;
+      }
+
+      /// A random index.
+      template <typename RandomGenerator>
+      unsigned operator()(RandomGenerator& gen) const
+      {
+        auto n = prob_.size();
+        auto u = std::uniform_real_distribution<>(0, n)(gen);
+        auto i = std::min(size_t(u), n - 1);
+        return u - i < prob_[i] ? i : alias_[i];
+      }
+
+    private:
+      /// The probability to keep each index.
+      std::vector<double> prob_;
+      /// The index to use otherwise.
+      std::vector<unsigned> alias_;
+    };
+
+    /*-------------------.
+    | uniform_sampler.   |
+    `-------------------*/
+
+    /// Draw words of a given length uniformly among those accepted
+    /// by a deterministic automaton.
+    ///
+    /// The number of words of length k accepted from each state is
+    /// computed once (with arbitrary precision): it is the sum of
+    /// the numbers of words of length k-1 accepted from its
+    /// successors.  A word is then one random number below the
+    /// number of accepted words, which is decoded letter by letter:
+    /// at each state, the outgoing transition is the one whose range
+    /// in the cumulated counts contains it.
+    ///
+    /// \pre the automaton is deterministic, on letters.
+    template <Automaton Aut>
+    class uniform_sampler
+    {
+    public:
+      using automaton_t = Aut;
+      using context_t = context_t_of<automaton_t>;
+      using label_t = label_t_of<automaton_t>;
+      using word_t = word_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+
+      uniform_sampler(const automaton_t& aut, unsigned length)
+        : aut_{aut}
+        , length_{length}
+        , out_(states_size(aut_))
+        , cumul_(length_ + 1)
+      {
+        auto n = states_size(aut_);
+        for (auto s: aut_->states())
+          for (auto t: out(aut_, s))
+            out_[s].emplace_back(aut_->label_of(t), aut_->dst_of(t));
+
+        // The number of accepted words of length k from each state.
+        auto count = std::vector<mpz_class>(n);
+        for (auto s: aut_->states())
+          if (aut_->is_final(s))
+            count[s] = 1;
+        for (unsigned k = 1; k <= length_; ++k)
+          {
+            auto next = std::vector<mpz_class>(n);
+            cumul_[k].resize(n);
+            for (auto s: aut_->states())
+              {
+                auto& c = cumul_[k][s];
+                for (const auto& t: out_[s])
+                  {
+                    next[s] += count[t.second];
+                    c.emplace_back(next[s]);
+                  }
+              }
+            count = std::move(next);
+          }
+
+        for (auto t: initial_transitions(aut_))
+          {
+            initial_ = aut_->dst_of(t);
+            size_ = count[initial_];
+          }
+        require(size_ != 0,
+                "sample: no accepted word of length ", length_);
+        rand_.seed(make_random_engine()());
+      }
+
+      /// The number of accepted words of this length.
+      const mpz_class& size() const
+      {
+        return size_;
+      }
+
+      /// A random accepted word.
+      word_t operator()()
+      {
+        auto res = word_t{};
+        mpz_class r = rand_.get_z_range(size_);
+        auto s = initial_;
+        for (auto k = length_; k; --k)
+          {
+            // The first transition whose range ends after r.
+            const auto& c = cumul_[k][s];
+            auto i = size_t(std::upper_bound(begin(c), end(c), r) - begin(c));
+            if (i)
+              r -= c[i - 1];
+            res.push_back(out_[s][i].first);
+            s = out_[s][i].second;
+          }
+        return res;
+      }
+
+    private:
+      automaton_t aut_;
+      /// The length of the words.
+      unsigned length_;
+      /// The outgoing transitions of each state, but the final ones.
+      std::vector<std::vector<std::pair<label_t, state_t>>> out_;
+      /// For each length k and state s, the number of accepted words
+      /// of length k from s that start with each of its transitions,
+      /// cumulated.
+      std::vector<std::vector<std::vector<mpz_class>>> cumul_;
+      /// The initial state.
+      state_t initial_ = automaton_t::element_type::null_state();
+      /// The number of accepted words.
+      mpz_class size_ = 0;
+      /// To draw the random numbers.
+      gmp_randclass rand_{gmp_randinit_default};
+    };
+
+    /*--------------------.
+    | weighted_sampler.   |
+    `--------------------*/
+
+    /// The probability denoted by a weight.
+    inline double sample_probability(const r&, double w)
+    {
+      require(0 <= w, "sample: negative weight: ", w);
+      return w;
+    }
+
+    /// The probability denoted by a weight, i.e., `exp(-w)`.
+    inline double sample_probability(const vcsn::log&, double w)
+    {
+      return std::exp(-w);
+    }
+
+    /// Draw words with a probability proportional to their weight,
+    /// in an automaton whose weights are non-negative.
+    ///
+    /// A random path is drawn, transition by transition, each one
+    /// with a probability proportional to its weight times the total
+    /// weight of the words that follow it, so that the probability
+    /// of a path is proportional to its weight.  The weight of a word
+    /// being the sum of the weights of its paths, so is its
+    /// probability to be drawn.  Since the automaton needs not be
+    /// deterministic, it is not determinized.
+    ///
+    /// Without a length, the words that follow a transition are
+    /// those accepted from its destination, whose total weight is
+    /// computed once, by a linear solve, and each state has an alias
+    /// table, to draw its transitions (including the final one) in
+    /// constant time.  With a length, there is an alias table per
+    /// state and remaining length, and the words that follow a
+    /// transition are those of the remaining length.
+    template <Automaton Aut>
+    class weighted_sampler
+    {
+    public:
+      using automaton_t = Aut;
+      using context_t = context_t_of<automaton_t>;
+      using labelset_t = labelset_t_of<context_t>;
+      using label_t = label_t_of<context_t>;
+      using word_t = word_t_of<context_t>;
+      using weightset_t = weightset_t_of<context_t>;
+      using state_t = state_t_of<automaton_t>;
+
+      /// \param aut     the automaton
+      /// \param length  the length of the words, or -1 for any length.
+      weighted_sampler(const automaton_t& aut, int length)
+        : aut_{aut}
+        , out_(states_size(aut_))
+      {
+        const auto& ws = *aut_->weightset();
+        auto n = states_size(aut_);
+        auto prob = std::vector<std::vector<double>>(n);
+        for (auto s: aut_->all_states())
+          for (auto t: all_out(aut_, s))
+            {
+              out_[s].emplace_back(aut_->label_of(t), aut_->dst_of(t));
+              prob[s].emplace_back(sample_probability(ws,
+                                                      aut_->weight_of(t)));
+            }
+
+        if (length < 0)
+          {
+            auto weight = suffix_weights_(prob);
+            require(weight[aut_->pre()], "sample: no accepted word");
+            tables_.emplace_back(n);
+            for (auto s: aut_->all_states())
+              if (weight[s])
+                {
+                  for (size_t i = 0; i < out_[s].size(); ++i)
+                    prob[s][i] *= weight[out_[s][i].second];
+                  tables_[0][s] = alias_table{prob[s]};
+                }
+          }
+        else
+          {
+            // The weight of the words of length k - 1 from each
+            // state, up to a factor common to all the states.  Before
+            // the first letter: one for post, zero otherwise.
+            auto weight = std::vector<double>(n);
+            weight[aut_->post()] = 1;
+            // Length plus two steps: initial and final transitions.
+            tables_.resize(length + 2);
+            for (auto& t: tables_)
+              {
+                t.resize(n);
+                auto next = std::vector<double>(n);
+                auto max = 0.0;
+                for (auto s: aut_->all_states())
+                  {
+                    auto ps = prob[s];
+                    for (size_t i = 0; i < ps.size(); ++i)
+                      {
+                        ps[i] *= weight[out_[s][i].second];
+                        next[s] += ps[i];
+                      }
+                    if (next[s])
+                      t[s] = alias_table{ps};
+                    max = std::max(max, next[s]);
+                  }
+                // Avoid underflows.
+                if (max)
+                  for (auto& w: next)
+                    w /= max;
+                weight = std::move(next);
+              }
+            require(weight[aut_->pre()],
+                    "sample: no accepted word of length ", length);
+          }
+      }
+
+      /// A random word.
+      template <typename RandomGenerator>
+      word_t operator()(RandomGenerator& gen) const
+      {
+        const auto& ls = *aut_->labelset();
+        auto res = word_t{};
+        auto s = aut_->pre();
+        for (auto k = tables_.size() - 1; s != aut_->post();
+             k -= bool(k))
+          {
+            const auto& o = out_[s][tables_[k][s](gen)];
+            if (!ls.is_special(o.first))
+              res.push_back(o.first);
+            s = o.second;
+          }
+        return res;
+      }
+
+    private:
+      /// The total weight of the words accepted from each state, given
+      /// the probabilities \a prob of the transitions of each state.
+      ///
+      /// The solution of `w(s) = sum_t prob(t) w(dst(t))` with
+      /// `w(post) = 1`.  The strongly connected components are solved
+      /// one after the other, successors first, each one by Gaussian
+      /// elimination: cubic in the size of the largest component.
+      std::vector<double>
+      suffix_weights_(const std::vector<std::vector<double>>& prob) const
+      {
+        auto n = states_size(aut_);
+        auto res = std::vector<double>(n);
+        res[aut_->post()] = 1;
+        // The component of each state, and its index in it.
+        auto comp = std::vector<size_t>(n, -1);
+        auto index = std::vector<size_t>(n);
+        // Tarjan's algorithm lists the successors first.
+        const auto cs = strong_components(aut_, tarjan_iterative_tag{});
+        for (size_t c = 0; c < cs.size(); ++c)
+          {
+            auto ss = std::vector<state_t>(begin(cs[c]), end(cs[c]));
+            auto k = ss.size();
+            for (size_t i = 0; i < k; ++i)
+              {
+                comp[ss[i]] = c;
+                index[ss[i]] = i;
+              }
+            // The system (I - P) w = b, where b is the weight of the
+            // words that leave the component, in the last column.
+            auto a = std::vector<std::vector<double>>(k,
+                                                      std::vector<double>(k + 1));
+            auto leaves = false;
+            for (size_t i = 0; i < k; ++i)
+              {
+                auto s = ss[i];
+                a[i][i] = 1;
+                for (size_t t = 0; t < out_[s].size(); ++t)
+                  {
+                    auto d = out_[s][t].second;
+                    if (comp[d] == c)
+                      a[i][index[d]] -= prob[s][t];
+                    else
+                      a[i][k] += prob[s][t] * res[d];
+                  }
+                leaves |= bool(a[i][k]);
+              }
+            // Not coaccessible.
+            if (!leaves)
+              continue;
+            for (size_t i = 0; i < k; ++i)
+              {
+                auto p = i;
+                for (size_t j = i + 1; j < k; ++j)
+                  if (std::abs(a[p][i]) < std::abs(a[j][i]))
+                    p = j;
+                std::swap(a[i], a[p]);
+                require(1e-12 < std::abs(a[i][i]),
+                        "sample: the weights of the words do not converge");
+                for (size_t j = i + 1; j < k; ++j)
+                  if (auto f = a[j][i] / a[i][i])
+                    for (size_t l = i; l <= k; ++l)
+                      a[j][l] -= f * a[i][l];
+              }
+            for (size_t i = k; i--; )
+              {
+                auto w = a[i][k];
+                for (size_t j = i + 1; j < k; ++j)
+                  w -= a[i][j] * res[ss[j]];
+                w /= a[i][i];
+                // Negative weights denote a divergent sum.
+                require(std::isfinite(w) && -1e-9 <= w,
+                        "sample: the weights of the words do not converge");
+                res[ss[i]] = std::max(w, 0.0);
+              }
+          }
+        for (size_t t = 0; t < out_[aut_->pre()].size(); ++t)
+          res[aut_->pre()]
+            += prob[aut_->pre()][t] * res[out_[aut_->pre()][t].second];
+        return res;
+      }
+
+      automaton_t aut_;
+      /// The outgoing transitions of each state.
+      std::vector<std::vector<std::pair<label_t, state_t>>> out_;
+      /// For each remaining number of transitions (from the last
+      /// one), and each state, the distribution of its outgoing
+      /// transitions.  Only one when the length is free.
+      std::vector<std::vector<alias_table>> tables_;
+    };
+
+    /// Whether words can be drawn from automata of type Aut.
+    template <Automaton Aut>
+    constexpr bool is_sampleable()
+    {
+      using ws_t = weightset_t_of<Aut>;
+      return (context_t_of<Aut>::is_lal
+              && (std::is_same<ws_t, b>::value
+                  || std::is_same<ws_t, r>::value
+                  || std::is_same<ws_t, vcsn::log>::value));
+    }
+  }
+
+  /*---------.
+  | sample.  |
+  `---------*/
+
+  /// Random words of \a aut.
+  ///
+  /// \param aut     an automaton on letters, Boolean, or whose weights
+  ///                are non-negative (r or log).
+  /// \param num     the number of words to draw.
+  /// \param length  the length of the words, or -1 for any length.
+  ///
+  /// On Boolean automata, the words are drawn uniformly among the
+  /// accepted words of length \a length, which is required.  The
+  /// automaton is determinized if needed.  Otherwise, they are drawn
+  /// with a probability proportional to their weight.
+  template <Automaton Aut>
+  std::vector<word_t_of<Aut>>
+  sample(const Aut& aut, unsigned num, int length = -1)
+  {
+    static_assert(detail::is_sampleable<Aut>(),
+                  "sample: requires letters, and a b, r or log weightset");
+    auto res = std::vector<word_t_of<Aut>>{};
+    res.reserve(num);
+    detail::static_if<std::is_same<weightset_t_of<Aut>, b>::value>
+      ([num, length, &res](const auto& aut)
+       {
+         require(0 <= length,
+                 "sample: Boolean automata require a length");
+         auto run = [num, &res](auto&& s)
+           {
+             for (unsigned i = 0; i < num; ++i)
+               res.emplace_back(s());
+           };
+         if (is_deterministic(aut))
+           run(detail::uniform_sampler<Aut>{aut, unsigned(length)});
+         else
+           {
+             auto d = determinize(aut);
+             run(detail::uniform_sampler<decltype(d)>{d, unsigned(length)});
+           }
+       },
+       [num, length, &res](const auto& aut)
+       {
+         auto& gen = make_random_engine();
+         auto s = detail::weighted_sampler<Aut>{aut, length};
+         for (unsigned i = 0; i < num; ++i)
+           res.emplace_back(s(gen));
+       })
+      (aut);
+    return res;
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut, typename Unsigned, typename Int>
+      std::vector<word>
+      sample(const automaton& aut, unsigned num, int length)
+      {
+        const auto& a = aut->as<Aut>();
+        return vcsn::detail::static_if<vcsn::detail::is_sampleable<Aut>()>
+          ([num, length](const auto& a)
+           {
+             auto ls = make_wordset(*a->labelset());
+             auto res = std::vector<word>{};
+             res.reserve(num);
+             for (auto&& w: ::vcsn::sample(a, num, length))
+               res.emplace_back(ls, std::move(w));
+             return res;
+           },
+           [](const auto& a) -> std::vector<word>
+           {
+             raise("sample: unsupported context: ", a->context(),
+                   ", expected letters, and b, r or log");
+           })
+          (a);
+      }
+    }
+  }
+}
@@ -138,7 +138,8 @@ namespace vcsn
               if (p.second)
                 p.first->second = queue.emplace(neighbor);
               else
-                queue.update(p.first->second);
+                // The queue holds a copy of the node: update it too.
+                queue.update(p.first->second, neighbor);
             }
           }
         }
@@ -7,6 +7,7 @@
 #include <boost/heap/binomial_heap.hpp>
 #include <boost/optional.hpp>
 
+#include <vcsn/algos/detail/path-tree.hh>
 #include <vcsn/algos/is-acyclic.hh>
 #include <vcsn/algos/lightest-path.hh>
 #include <vcsn/ctx/context.hh>
@@ -44,20 +45,25 @@ namespace vcsn
       using weight_t = weight_t_of<automaton_t>;
       using state_t = state_t_of<automaton_t>;
 
+      /// The words read so far, shared as a tree.
+      using path_tree_t = path_tree<context_t, labelset_t>;
+      using node_t = typename path_tree_t::node_t;
+
+      using profile_t = std::tuple<state_t, node_t, weight_t>;
       /// Used in the case of non-free labelsets.
-      using profile_t = std::tuple<state_t, word_t, weight_t>;
       struct profile_less
       {
         /// Whether l < r (as this is a max heap).
         bool operator()(const profile_t& r, const profile_t& l) const
         {
-          if (labelset_t::less(std::get<1>(l), std::get<1>(r)))
-            return true;
-          else if (labelset_t::less(std::get<1>(r), std::get<1>(l)))
-            return false;
+          if (!paths->equal(std::get<1>(l), std::get<1>(r)))
+            return paths->less(std::get<1>(l), std::get<1>(r));
           else
             return std::get<0>(l) < std::get<0>(r);
         }
+
+        /// The words of the profiles.
+        const path_tree_t* paths;
       };
 
       /// Prepare to compute an approximation of the behavior.
@@ -95,7 +101,7 @@ namespace vcsn
     private:
       /// Case of free labelsets (e.g., `lal` or `lal x lal`).
       ///
-      /// We maintain a list of current tuples of (state, label, weight).
+      /// We maintain a list of current tuples of (state, path, weight).
       /// During one round we pass them all through outgoing
       /// transitions, which gives the next list of (state, label, weight).
       ///
@@ -113,8 +119,9 @@ namespace vcsn
         if (len != std::numeric_limits<unsigned>::max())
           len += 2;
 
+        auto paths = path_tree_t{ls_};
         using queue_t = std::deque<profile_t>;
-        auto queue = queue_t{profile_t{src, ls_.one(), ws_.one()}};
+        auto queue = queue_t{profile_t{src, paths.root(), ws_.one()}};
 
         // The approximated behavior: the first orders to post's past.
         auto output = ps_.zero();
@@ -125,23 +132,25 @@ namespace vcsn
             queue_t q2;
             for (const auto& sm: queue)
               {
-                state_t s; word_t l; weight_t w;
+                state_t s; node_t l; weight_t w;
                 std::tie(s, l, w) = sm;
                 for (const auto t: all_out(aut_, s))
                   {
                     auto t_dst = aut_->dst_of(t);
                     auto nw = ws_.mul(w, aut_->weight_of(t));
                     if (t_dst == aut_->post() && t_dst == dst)
-                      ps_.add_here(output, l, std::move(nw));
+                      ps_.add_here(output, paths.word(l), std::move(nw));
                     else if (aut_->src_of(t) == aut_->pre()
                              || t_dst == aut_->post())
                       q2.emplace_back(t_dst, l, std::move(nw));
                     else if (t_dst == dst)
-                      ps_.add_here(output, ls_.mul(l, aut_->label_of(t)),
+                      ps_.add_here(output,
+                                   paths.word(paths.extend(l,
+                                                           aut_->label_of(t))),
                                    std::move(nw));
                     else
                       q2.emplace_back(t_dst,
-                                      ls_.mul(l, aut_->label_of(t)),
+                                      paths.extend(l, aut_->label_of(t)),
                                       std::move(nw));
                   }
               }
@@ -175,14 +184,15 @@ namespace vcsn
           boost::heap::binomial_heap<profile_t,
                                      boost::heap::compare<profile_less>>;
 
-        auto queue = queue_t{};
-        queue.emplace(src, ls_.one(), ws_.one());
+        auto paths = path_tree_t{ls_};
+        auto queue = queue_t{profile_less{&paths}};
+        queue.emplace(src, paths.root(), ws_.one());
 
         // The approximated behavior: the first orders to post's past.
         auto res = ps_.zero();
         while (!queue.empty())
           {
-            state_t s; word_t l; weight_t w;
+            state_t s; node_t l; weight_t w;
             std::tie(s, l, w) = queue.top();
 
             // Take all the top of the queue if they have the same
@@ -197,7 +207,7 @@ namespace vcsn
 
             while (!queue.empty()
                    && std::get<0>(queue.top()) == s
-                   && ls_.equal(std::get<1>(queue.top()), l))
+                   && paths.equal(std::get<1>(queue.top()), l))
               {
                 w = ws_.add(w, std::get<2>(queue.top()));
                 queue.pop();
@@ -208,22 +218,22 @@ namespace vcsn
                 auto t_dst = aut_->dst_of(t);
                 auto nw = ws_.mul(w, aut_->weight_of(t));
                 if (t_dst == aut_->post() && t_dst == dst)
-                  ps_.add_here(res, l, std::move(nw));
+                  ps_.add_here(res, paths.word(l), std::move(nw));
                 else if (aut_->src_of(t) == aut_->pre()
                          || t_dst == aut_->post())
                   queue.emplace(t_dst, l, std::move(nw));
                 else if (t_dst == dst)
                 {
-                  auto nl = ls_.mul(l, aut_->label_of(t));
+                  auto nl = paths.word(paths.extend(l, aut_->label_of(t)));
                   // Discard candidates that are too long.
                   if (ls_.size(nl) <= len)
                     ps_.add_here(res, std::move(nl), std::move(nw));
                 }
                 else
                   {
-                    auto nl = ls_.mul(l, aut_->label_of(t));
+                    auto nl = paths.extend(l, aut_->label_of(t));
                     // Discard candidates that are too long.
-                    if (ls_.size(nl) <= len)
+                    if (paths.size(nl) <= len)
                       queue.emplace(t_dst, std::move(nl), std::move(nw));
                   }
               }
@@ -233,7 +243,7 @@ namespace vcsn
             // other states), we're done.
             if (queue.empty()
                 || (num == res.size()
-                    && !ls_.equal(std::get<1>(queue.top()), l)))
+                    && !paths.equal(std::get<1>(queue.top()), l)))
               break;
           }
 
@@ -243,7 +253,8 @@ namespace vcsn
     private:
       /// Show the heap, for debugging.
       template <typename Queue>
-      void show_heap_(const Queue& q, std::ostream& os = std::cerr) const
+      void show_heap_(const Queue& q, const path_tree_t& paths,
+                      std::ostream& os = std::cerr) const
       {
         const char* sep = "";
         for (auto i = q.ordered_begin(), end = q.ordered_end();
@@ -253,7 +264,7 @@ namespace vcsn
             sep = ", ";
             aut_->print_state_name(std::get<0>(*i), os) << ":<";
             ws_.print(std::get<2>(*i), os) << '>';
-            ls_.print(std::get<1>(*i), os);
+            ls_.print(paths.word(std::get<1>(*i)), os);
           }
         os << '\n';
       }
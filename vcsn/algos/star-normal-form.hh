@@ -87,11 +87,10 @@ namespace vcsn
       // Plain traversal for sums.
       VCSN_RAT_VISIT(add, v)
       {
-        v.head()->accept(*this);
-        expression_t res = res_;
-        for (auto c: v.tail())
-          res = rs_.add(res, rec_(c));
-        res_ = std::move(res);
+        auto res = typename expressionset_t::add_builder{rs_};
+        for (auto c: v)
+          res.add(rec_(c));
+        res_ = res.finish();
       }
 
       VCSN_RAT_UNSUPPORTED(complement)
@@ -135,20 +134,20 @@ namespace vcsn
         else
           {
             // All the factors have a non null constant-term.
-            expression_t res = rec_(v.head());
-            for (auto c: v.tail())
-              res = rs_.add(res, rec_(c));
-            res_ = std::move(res);
+            auto res = typename expressionset_t::add_builder{rs_};
+            for (auto c: v)
+              res.add(rec_(c));
+            res_ = res.finish();
           }
       }
 
       /// Handling of a product by the dot operator.
       void dot_of(const mul_t& v)
       {
-        expression_t res = rec_(v.head());
-        for (auto c: v.tail())
-          res = rs_.mul(res, rec_(c));
-        res_ = std::move(res);
+        auto res = typename expressionset_t::mul_builder{rs_};
+        for (auto c: v)
+          res.mul(rec_(c));
+        res_ = res.finish();
       }
 
       VCSN_RAT_VISIT(star, v)
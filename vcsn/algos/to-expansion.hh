@@ -7,7 +7,9 @@
 #include <vcsn/core/rat/visitor.hh>
 #include <vcsn/ctx/fwd.hh>
 #include <vcsn/dyn/value.hh>
+#include <vcsn/misc/functional.hh> // hash
 #include <vcsn/misc/indent.hh>
+#include <vcsn/misc/lru-cache.hh>
 #include <vcsn/misc/map.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/weightset/polynomialset.hh>
@@ -28,6 +30,22 @@ namespace vcsn
   namespace rat
   {
 
+    /*------------------.
+    | expansion_cache.  |
+    `------------------*/
+
+    /// A bounded cache of expansions, indexed by expressions.
+    ///
+    /// To share between computations that need the expansions of the
+    /// same expressions (e.g., several derived-term automata of
+    /// expressions with common derived terms).  The expressions must
+    /// all belong to the same expressionset.
+    template <typename ExpSet>
+    using expansion_cache
+      = lru_cache<typename ExpSet::value_t,
+                  typename expansionset<ExpSet>::value_t,
+                  vcsn::hash<ExpSet>, vcsn::equal_to<ExpSet>>;
+
     /*------------------------.
     | to_expansion_visitor.   |
     `------------------------*/
@@ -58,18 +76,29 @@ namespace vcsn
 
       using polys_t = typename expansionset_t::polys_t;
       using expansion_t = typename expansionset_t::value_t;
+      using cache_t = expansion_cache<expressionset_t>;
 
-      to_expansion_visitor(const expressionset_t& rs)
+      /// \param rs     the expressionset
+      /// \param cache  if not null, where to look for the expansions
+      ///               before computing them, and to store them.
+      to_expansion_visitor(const expressionset_t& rs,
+                           std::shared_ptr<cache_t> cache = nullptr)
         : rs_(rs)
+        , shared_cache_(std::move(cache))
       {}
 
       /// From an expression, build its expansion.
       expansion_t operator()(const expression_t& v)
       {
+        if (shared_cache_)
+          if (auto res = shared_cache_->find(v))
+            return *res;
         try
           {
             res_ = xs_.zero();
             v->accept(*this);
+            if (shared_cache_)
+              shared_cache_->emplace(v, res_);
             return res_;
           }
         catch (const std::runtime_error& e)
@@ -192,7 +221,8 @@ namespace vcsn
             res_ = to_expansion(e[0]);
             xs_.denormalize(res_);
             xs_.rmul_label_here(res_,
-                                prod_(std::next(e.begin()), std::end(e)));
+                                rs_.mul_range(std::next(e.begin()),
+                                              std::end(e)));
           }
         else
           {
@@ -227,9 +257,10 @@ namespace vcsn
               {
                 expression_t rhss
                   = transposed_
-                  ? rs_.transposition(prod_(e.begin(),
-                                            std::next(e.begin(), size-(i+1))))
-                  : prod_(std::next(e.begin(), i + 1), std::end(e));
+                  ? rs_.transposition(rs_.mul_range(e.begin(),
+                                                    std::next(e.begin(),
+                                                              size-(i+1))))
+                  : rs_.mul_range(std::next(e.begin(), i + 1), std::end(e));
                 // rmul_label_here requires a null constant term,
                 // please it.
                 auto w = std::move(rhs.constant);
@@ -249,22 +280,6 @@ namespace vcsn
           }
       }
 
-      /// Build a product for these expressions.  Pay attention to not
-      /// building products with 0 or 1 expression.
-      ///
-      /// FIXME: Code duplication with derivation.
-      expression_t
-      prod_(typename mul_t::iterator begin,
-            typename mul_t::iterator end) const
-      {
-        using expressions_t = typename mul_t::values_t;
-        assert(begin != end);
-        if (std::next(begin, 1) == end)
-          return *begin;
-        else
-          return std::make_shared<mul_t>(expressions_t{begin, end});
-      }
-
       VCSN_RAT_VISIT(ldivide, e)
       {
         assert(e.size() == 2);
@@ -461,6 +476,9 @@ namespace vcsn
       /// Manipulate the expansions.
       expansionset_t xs_ = {rs_};
 
+      /// The expansions of the top-level expressions, possibly shared
+      /// with other computations.
+      std::shared_ptr<cache_t> shared_cache_;
       /// Whether to work transposed.
       bool transposed_ = false;
       /// The result.
@@ -479,6 +497,16 @@ namespace vcsn
     return to_expansion(e);
   }
 
+  /// First order expansion, using and filling \a cache.
+  template <typename ExpSet>
+  typename rat::expansionset<ExpSet>::value_t
+  to_expansion(const ExpSet& rs, const typename ExpSet::value_t& e,
+               const std::shared_ptr<rat::expansion_cache<ExpSet>>& cache)
+  {
+    auto to_expansion = rat::to_expansion_visitor<ExpSet>{rs, cache};
+    return to_expansion(e);
+  }
+
   namespace dyn
   {
     namespace detail
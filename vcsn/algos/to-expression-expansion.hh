@@ -16,11 +16,11 @@ namespace vcsn
   {
     const auto& es = xs.expressionset();
     const auto& ps = xs.polynomialset();
-    auto res = es.lweight(x.constant, es.one());
+    auto res = typename ExpansionSet::expressionset_t::add_builder{es};
+    res.add(es.lweight(x.constant, es.one()));
     for (const auto& p: x.polynomials)
-      res = es.add(res,
-                   es.mul(es.atom(p.first), ps.to_label(p.second)));
-    return res;
+      res.add(es.mul(es.atom(p.first), ps.to_label(p.second)));
+    return res.finish();
   }
 
   namespace dyn
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vcsn/algos/accessible.hh> // is_trim
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/lift.hh>
 #include <vcsn/core/automaton.hh> // all_in
@@ -9,6 +10,7 @@
 #include <vcsn/dyn/value.hh>
 #include <vcsn/misc/builtins.hh>
 #include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/portfolio.hh>
 #include <vcsn/misc/vector.hh>
 #include <vcsn/misc/fibonacci_heap.hh>
 
@@ -213,6 +215,58 @@ namespace vcsn
     };
   }
 
+  namespace detail
+  {
+    /*--------------------.
+    | Bounded profiler.   |
+    `--------------------*/
+
+    /// A Delgado profiler that makes a variant of a portfolio give up
+    /// as soon as one of its transitions is larger than the best
+    /// result so far.  The size of the transitions is computed anyway
+    /// by the Delgado profiler, so checking the bound is almost free.
+    ///
+    /// This is sound only if the result contains the weight of every
+    /// transition: the automaton must be trim, and the identities
+    /// must not be linear (e.g., `<-1>a+a` is `\z`).  When counting
+    /// labels, the number of atoms is still a lower bound of the
+    /// size.
+    template <Automaton Aut, typename Control>
+    struct bounded_profiler
+      : delgado_profiler<Aut>
+    {
+      using super_t = delgado_profiler<Aut>;
+      using transition_t = typename super_t::transition_t;
+
+      template <typename... Args>
+      bounded_profiler(const Control& control, Args&&... args)
+        : super_t(std::forward<Args>(args)...)
+        , control_(control)
+      {}
+
+      void invalidate_cache(transition_t t)
+      {
+        super_t::invalidate_cache(t);
+        if (control_.bounded())
+          control_.check(this->size_of_transition(t));
+      }
+
+      const Control& control_;
+    };
+
+    /// The Control of a bounded_profiler that never gives up.
+    struct unbounded
+    {
+      constexpr bool bounded() const
+      {
+        return false;
+      }
+
+      void check(size_t) const
+      {}
+    };
+  }
+
   /*------------------.
   | eliminate_state.  |
   `------------------*/
@@ -515,6 +569,46 @@ namespace vcsn
       naive,
     };
 
+  namespace detail
+  {
+    /// Eliminate the states of the lifted automaton \a a, in the order
+    /// given by \a algo.
+    ///
+    /// \param control  the bound from a portfolio, if any.
+    template <typename ExpSet, Automaton Aut, typename Control>
+    typename ExpSet::value_t
+    to_expression_lifted(Aut& a, to_expression_heuristic_t algo,
+                         const Control& control)
+    {
+      using delgado_t = bounded_profiler<Aut, Control>;
+      using naive_t = naive_profiler<Aut>;
+      switch (algo)
+        {
+        case to_expression_heuristic_t::best:
+          raise("next_state: invalid algorithm: best");
+
+        case to_expression_heuristic_t::delgado:
+          {
+            auto profiler = delgado_t(control, a);
+            return to_expression<Aut, delgado_t, ExpSet>(a, profiler);
+          }
+
+        case to_expression_heuristic_t::delgado_label:
+          {
+            auto profiler = delgado_t(control, a, true);
+            return to_expression<Aut, delgado_t, ExpSet>(a, profiler);
+          }
+
+        case to_expression_heuristic_t::naive:
+          {
+            auto profiler = naive_t(a);
+            return to_expression<Aut, naive_t, ExpSet>(a, profiler);
+          }
+        }
+      BUILTIN_UNREACHABLE();
+    }
+  }
+
   template <Automaton Aut,
             typename ExpSet = expressionset<context_t_of<Aut>>>
   typename ExpSet::value_t
@@ -523,32 +617,8 @@ namespace vcsn
   {
     // State elimination is performed on the lifted automaton.
     auto a = lift(aut, ids);
-    using delgado_t = detail::delgado_profiler<decltype(a)>;
-    using naive_t = detail::naive_profiler<decltype(a)>;
-    switch (algo)
-    {
-    case to_expression_heuristic_t::best:
-      raise("next_state: invalid algorithm: best");
-
-    case to_expression_heuristic_t::delgado:
-      {
-        auto profiler = delgado_t(a);
-        return to_expression<decltype(a), delgado_t, ExpSet>(a, profiler);
-      }
-
-    case to_expression_heuristic_t::delgado_label:
-      {
-        auto profiler = delgado_t(a, true);
-        return to_expression<decltype(a), delgado_t, ExpSet>(a, profiler);
-      }
-
-    case to_expression_heuristic_t::naive:
-      {
-        auto profiler = naive_t(a);
-        return to_expression<decltype(a), naive_t, ExpSet>(a, profiler);
-      }
-    }
-    BUILTIN_UNREACHABLE();
+    return detail::to_expression_lifted<ExpSet>(a, algo,
+                                                detail::unbounded{});
   }
 
   template <Automaton Aut,
@@ -559,21 +629,33 @@ namespace vcsn
   {
     if (algo == to_expression_heuristic_t::best)
       {
-        typename ExpSet::value_t best;
-        auto best_size = std::numeric_limits<size_t>::max();
-        for (auto a: {to_expression_heuristic_t::delgado,
-                      to_expression_heuristic_t::delgado_label,
-                      to_expression_heuristic_t::naive})
+        // Run the heuristics concurrently, and keep the smallest
+        // result.
+        using expression_t = typename ExpSet::value_t;
+        using portfolio_t = portfolio<expression_t>;
+        portfolio_t p;
+        auto bounded = !ids.is_linear() && is_trim(aut);
+        for (auto algo: {to_expression_heuristic_t::delgado,
+                         to_expression_heuristic_t::delgado_label,
+                         to_expression_heuristic_t::naive})
           {
-            auto r = to_expression_heuristic<Aut, ExpSet>(aut, ids, a);
-            auto s = rat::size<ExpSet>(r);
-            if (s < best_size)
-              {
-                best = r;
-                best_size = s;
-              }
+            // Lift here rather than in the variants: reading aut
+            // concurrently is not safe (e.g., lazy automata).
+            auto a = lift(aut, ids);
+            p.add([a, algo, bounded](const typename portfolio_t::control& c)
+                  mutable
+                  {
+                    if (bounded)
+                      return detail::to_expression_lifted<ExpSet>(a, algo, c);
+                    else
+                      return detail::to_expression_lifted<ExpSet>
+                        (a, algo, detail::unbounded{});
+                  });
           }
-        return best;
+        return p.best([](const expression_t& e)
+                      {
+                        return rat::size<ExpSet>(e);
+                      });
       }
     else
       {
@@ -20,7 +20,7 @@ namespace vcsn
   namespace detail
   {
     /// Turn a label into a parsable label: escape special characters.
-    std::string quote(const std::string& s)
+    inline std::string quote(const std::string& s)
     {
       if (s == "\\e"
           || (s.size() == 1 && std::isalnum(s[0])))
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vcsn/algos/distance.hh>
 #include <vcsn/algos/evaluate.hh>
 #include <vcsn/algos/lightest-path.hh>
 #include <vcsn/algos/to-spontaneous.hh>
@@ -19,6 +20,12 @@ namespace vcsn
   {
     try
       {
+        // The shortest distance from pre to post, if it is exact
+        // (e.g., acyclic automata), otherwise eliminate the
+        // spontaneous cycles.
+        auto sd = detail::shortest_distance_impl<Aut>{a};
+        if (sd.is_exact())
+          return sd(a->pre())[a->post()];
         auto aut = proper(to_spontaneous(a));
         return evaluate(aut);
       }
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+
+#include <boost/container/flat_set.hpp>
+#include <boost/range/iterator_range_core.hpp>
+
+#include <vcsn/alphabets/char.hh>
+#include <vcsn/misc/escape.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/functional.hh> // vcsn::less
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/stream.hh> // eat.
+#include <vcsn/misc/symbol.hh>
+
+namespace vcsn
+{
+  /// The chars whose code is in [First, Last].
+  ///
+  /// Contrary to set_alphabet, the letters are known at compile time:
+  /// there is no membership lookup, and each letter maps to a dense
+  /// index in [0, dense_size()), which allows algorithms to use
+  /// arrays instead of maps (see label_map_t).
+  ///
+  /// The reserved letters of char_letters, `\x00` and `\xff`, are
+  /// excluded.
+  template <unsigned char First, unsigned char Last>
+  class range_alphabet: public char_letters
+  {
+  public:
+    using L = char_letters;
+    using letter_t = typename L::letter_t;
+    using word_t = typename L::word_t;
+    using letters_t
+      = boost::container::flat_set<letter_t, vcsn::less<L, letter_t>>;
+    /// The type of our values, when seen as a container.
+    using value_type = letter_t;
+
+    static_assert(0 < First && First <= Last && Last < 255,
+                  "range_alphabet: invalid range");
+
+    /// The name includes the range, since it is part of the type.
+    static symbol sname()
+    {
+      static auto res = []
+        {
+          auto o = std::ostringstream{};
+          o << "char_range(";
+          L{}.print(letter_t(First), o, format::sname);
+          o << '-';
+          L{}.print(letter_t(Last), o, format::sname);
+          o << ')';
+          return symbol{o.str()};
+        }();
+      return res;
+    }
+
+    static range_alphabet make(std::istream& is)
+    {
+      // name: char_range(a-z)
+      //       ^^^^^^^^^^ ^^^
+      //       letter_type  gens
+      eat(is, "char_range");
+      eat(is, '(');
+      auto first = L::get_letter(is);
+      eat(is, '-');
+      auto last = L::get_letter(is);
+      eat(is, ')');
+      VCSN_REQUIRE(uint8_t(first) == First && uint8_t(last) == Last,
+                   sname(), ": make: unexpected range: ",
+                   str_escape(first), '-', str_escape(last));
+      return {};
+    }
+
+    /// The number of dense indexes: one per letter, plus one for
+    /// the special letter.
+    static constexpr size_t dense_size()
+    {
+      return Last - First + 2;
+    }
+
+    /// The index of \a l in [0, dense_size()).  Preserves the order
+    /// of the letters: the special letter is last.
+    /// \pre has(l) or l is special.
+    static size_t index(letter_t l)
+    {
+      if (l == special<letter_t>())
+        return dense_size() - 1;
+      else
+        {
+          assert(has(l));
+          return uint8_t(l) - First;
+        }
+    }
+
+    /// The letter whose index is \a i.
+    static letter_t letter(size_t i)
+    {
+      assert(i < dense_size() - 1);
+      return letter_t(First + i);
+    }
+
+    /// Whether unknown letters should be added, or rejected.  Fixed
+    /// alphabets are never open.
+    /// \returns   the previous status.
+    bool open(bool) const
+    {
+      return false;
+    }
+
+    /// Whether \a l is a letter.
+    static bool
+    has(letter_t l)
+    {
+      return First <= uint8_t(l) && uint8_t(l) <= Last;
+    }
+
+    /// Extract and return the next word from \a i.
+    word_t
+    get_word(std::istream& i) const
+    {
+      require(!i.bad(), *this, ": conv: invalid stream");
+      // Either an empty word: "\e", or a sequence of non-separators.
+      if (i.good() && i.peek() == '\\')
+        {
+          i.ignore();
+          int c = i.peek();
+          if (c == 'e')
+            {
+              i.ignore();
+              return {};
+            }
+          else
+            i.unget();
+        }
+
+      // Stop as soon as it might be a special character (such as
+      // delimiters in polynomials, or tuple separators).
+      word_t res;
+      int c = i.peek();
+      while (i.good()
+             && (c = i.peek()) != EOF
+             && !isspace(c)
+             && c != '+'
+             && c != ','
+             && c != '|'
+             && c != '('
+             && c != ')')
+        {
+          letter_t l = L::get_letter(i, true);
+          VCSN_REQUIRE(has(l), *this, ": invalid letter: ", str_escape(l));
+          res += l;
+        }
+      return res;
+    }
+
+  private:
+    using array_t = std::array<letter_t, dense_size() - 1>;
+
+    /// The letters, in order.
+    static const array_t& letters_()
+    {
+      static const auto res = []
+        {
+          auto res = array_t{};
+          for (size_t i = 0; i < res.size(); ++i)
+            res[i] = letter(i);
+          return res;
+        }();
+      return res;
+    }
+
+  public:
+    using iterator = typename array_t::const_iterator;
+    using const_iterator = typename array_t::const_iterator;
+
+    const_iterator cbegin() const
+    {
+      return letters_().begin();
+    }
+
+    const_iterator cend() const
+    {
+      return letters_().end();
+    }
+
+    const_iterator begin() const
+    {
+      return cbegin();
+    }
+
+    const_iterator end() const
+    {
+      return cend();
+    }
+
+    /// All the "pregenerators", including the empty word.
+    auto pregenerators() const
+    {
+      auto res = letters_t{cbegin(), cend()};
+      res.insert(L::one_letter());
+      return res;
+    }
+
+    /// All the generators.
+    auto generators() const
+    {
+      return boost::make_iterator_range(cbegin(), cend());
+    }
+
+    /// Whether this alphabet has no letters.
+    static constexpr bool empty()
+    {
+      return false;
+    }
+
+    /// Number of letters.
+    static constexpr size_t size()
+    {
+      return Last - First + 1;
+    }
+
+    const_iterator find(letter_t l) const
+    {
+      return has(l) ? cbegin() + index(l) : cend();
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          o << "\\{";
+          this->print(letter_t(First), o, fmt);
+          o << ", \\ldots, ";
+          this->print(letter_t(Last), o, fmt);
+          o << "\\}";
+          break;
+
+        case format::sname:
+          o << sname();
+          break;
+
+        case format::text:
+        case format::utf8:
+          o << '{';
+          this->print(letter_t(First), o, format::sname);
+          o << '-';
+          this->print(letter_t(Last), o, format::sname);
+          o << '}';
+          break;
+
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+
+    /// Compute the intersection with another alphabet.
+    friend range_alphabet
+    set_intersection(const range_alphabet& lhs, const range_alphabet&)
+    {
+      return lhs;
+    }
+
+    /// Compute the union with another alphabet.
+    friend range_alphabet
+    set_union(const range_alphabet& lhs, const range_alphabet&)
+    {
+      return lhs;
+    }
+  };
+}
@@ -3,32 +3,71 @@
 #include <cassert>
 #include <string>
 #include <iostream>
+#include <type_traits>
 
 #include <vcsn/misc/escape.hh>
 #include <vcsn/misc/format.hh>
 #include <vcsn/misc/functional.hh> // vcsn::lexicographical_cmp
 #include <vcsn/misc/raise.hh>
+#include <vcsn/misc/stream.hh> // get_char
+#include <vcsn/misc/string-id.hh>
 #include <vcsn/misc/symbol.hh>
 
 namespace vcsn
 {
+  namespace detail
+  {
+    /// What depends on the representation of the letters of
+    /// string_letters_impl.
+    template <typename Letter>
+    struct string_letter_traits;
+
+    template <>
+    struct string_letter_traits<symbol>
+    {
+      static const char* name() { return "string_letters"; }
+
+      /// Symbols are ordered as their strings.
+      static int compare(const symbol l, const symbol r)
+      {
+        return l.get().compare(r.get());
+      }
+    };
+
+    template <>
+    struct string_letter_traits<string_id>
+    {
+      static const char* name() { return "string_id_letters"; }
+
+      /// String ids are ordered as their ids.
+      static int compare(const string_id l, const string_id r)
+      {
+        return (r < l) - (l < r);
+      }
+    };
+
   /// Represent alphabets whose "letters" are strings.
   ///
   /// This is useful for linguistics where sometimes letters are words
   /// ("it is beautiful" has three letters: "it" "is" and "beautiful")
   /// but also to deal with UTF-8, since graphemes then have various
   /// widths.
-  class string_letters
+  ///
+  /// \tparam Letter  the representation of the letters: symbol
+  ///    (string_letters), or string_id (string_id_letters), whose
+  ///    comparisons do not look at the strings.
+  template <typename Letter>
+  class string_letters_impl
   {
   public:
-    using self_t = string_letters;
+    using self_t = string_letters_impl;
     /// Internalize the letters to save trees.
-    using letter_t = symbol;
+    using letter_t = Letter;
     using word_t = std::vector<letter_t>;
 
     static symbol sname()
     {
-      static auto res = symbol{"string_letters"};
+      static auto res = symbol{string_letter_traits<letter_t>::name()};
       return res;
     }
 
@@ -151,7 +190,7 @@ namespace vcsn
     /// Three-way comparison between two letters.
     static int compare(const letter_t l, const letter_t r)
     {
-      return l.get().compare(r.get());
+      return string_letter_traits<letter_t>::compare(l, r);
     }
 
     /// Three-way comparison between two words.
@@ -199,14 +238,22 @@ namespace vcsn
 
     /// The reserved letter used to forge the "one" label (the unit,
     /// the identity).
-    static letter_t one_letter() { return letter_t(""); }
+    static letter_t one_letter()
+    {
+      static const auto res = letter_t("");
+      return res;
+    }
 
   private:
     /// The reserved letter used to forge the labels for initial and
     /// final transitions.
     ///
     /// Use the public special() interface.
-    static letter_t special_letter() { return letter_t{std::string{char(0)}}; }
+    static letter_t special_letter()
+    {
+      static const auto res = letter_t{std::string{char(0)}};
+      return res;
+    }
 
   public:
     /// Read one letter from i.
@@ -283,22 +330,27 @@ namespace vcsn
     /// Special character, used to label transitions from pre() and to
     /// post().
     template <typename T = letter_t>
-    static T special();
-  };
+    static auto special()
+      -> std::enable_if_t<std::is_same<T, letter_t>{}, T>
+    {
+      return special_letter();
+    }
 
-  template <>
-  inline
-  string_letters::letter_t
-  string_letters::special<string_letters::letter_t>()
-  {
-    return special_letter();
+    /// Special word, used to label transitions from pre() and to
+    /// post().
+    template <typename T = letter_t>
+    static auto special()
+      -> std::enable_if_t<std::is_same<T, word_t>{}, T>
+    {
+      return {special_letter()};
+    }
+  };
   }
 
-  template <>
-  inline
-  string_letters::word_t
-  string_letters::special<string_letters::word_t>()
-  {
-    return {special_letter()};
-  }
+  /// Letters are strings, ordered lexicographically.
+  using string_letters = detail::string_letters_impl<symbol>;
+
+  /// Letters are strings, represented by ids: faster comparisons and
+  /// hashing, but letters are ordered by first occurrence.
+  using string_id_letters = detail::string_letters_impl<string_id>;
 }
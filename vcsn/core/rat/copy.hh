@@ -91,18 +91,26 @@ namespace vcsn
       }
 
       using ors_t = out_expressionset_t;
-      VCSN_RAT_VISIT(add, v)          { rec_(v, &ors_t::add); }
+      VCSN_RAT_VISIT(add, v)
+      {
+        auto sum = typename ors_t::add_builder{out_rs_};
+        for (const auto& c: v)
+          sum.add(rec_(c));
+        res_ = sum.finish();
+      }
       VCSN_RAT_VISIT(complement, v)   { rec_(v, &ors_t::complement); }
       VCSN_RAT_VISIT(compose, v)      { rec_(v, &ors_t::compose); }
       VCSN_RAT_VISIT(conjunction, v)  { rec_(v, &ors_t::conjunction); }
       VCSN_RAT_VISIT(infiltrate, v)   { rec_(v, &ors_t::infiltrate); }
       VCSN_RAT_VISIT(ldivide, v)      { rec_(v, &ors_t::ldivide); }
       VCSN_RAT_VISIT(one,)            { res_ = out_rs_.one(); }
-      using bin_t =
-        out_expression_t (ors_t::*)(const out_expression_t&,
-                                    const out_expression_t&) const;
-      VCSN_RAT_VISIT(mul, v)          { rec_(v,
-                                             static_cast<bin_t>(&ors_t::mul)); }
+      VCSN_RAT_VISIT(mul, v)
+      {
+        auto prod = typename ors_t::mul_builder{out_rs_};
+        for (const auto& c: v)
+          prod.mul(rec_(c));
+        res_ = prod.finish();
+      }
       VCSN_RAT_VISIT(shuffle, v)      { rec_(v, &ors_t::shuffle); }
       VCSN_RAT_VISIT(star, v)         { rec_(v, &ors_t::star); }
       VCSN_RAT_VISIT(transposition, v){ rec_(v, &ors_t::transposition); }
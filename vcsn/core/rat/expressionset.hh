@@ -272,6 +272,12 @@ namespace vcsn
     /// In other cases, synonym for mul.
     auto concat(const value_t& l, const value_t& r) const -> value_t;
 
+    /// The product of the expressions in [\a begin, \a end), as is,
+    /// without identities.  Products of zero or one expression are
+    /// not built: one(), or the expression itself.
+    template <typename Iterator>
+    auto mul_range(Iterator begin, Iterator end) const -> value_t;
+
     /// Build a composition: `l @ r`.
     auto compose(const value_t& l, const value_t& r) const -> value_t;
 
@@ -291,6 +297,60 @@ namespace vcsn
     /// Add a power operator: `e{n}`.
     auto power(const value_t& e, unsigned n) const -> value_t;
 
+    /// Build a sum of many terms.
+    ///
+    /// Repeated calls to add copy the terms gathered so far, which is
+    /// quadratic.  Instead, accumulate the terms, and apply the
+    /// identities once, in finish().  The result is the same as that
+    /// of the left-associative additions.
+    class add_builder
+    {
+    public:
+      add_builder(const expressionset_impl& rs);
+
+      /// Add \a v to the sum.
+      void add(const value_t& v);
+
+      /// The sum of the terms (zero if none).
+      value_t finish();
+
+    private:
+      const expressionset_impl& rs_;
+      /// The terms, when associative.
+      values_t terms_;
+      /// The sum so far, when not associative.
+      value_t res_;
+    };
+
+    /// Build a product of many factors.
+    ///
+    /// As add_builder, but for mul: runs of factors on which no
+    /// identity applies are gathered once.
+    class mul_builder
+    {
+    public:
+      mul_builder(const expressionset_impl& rs);
+
+      /// Multiply the product by \a v, on the right.
+      void mul(const value_t& v);
+
+      /// The product of the factors (one if none).
+      value_t finish();
+
+    private:
+      /// Whether the product of \a v with a simple factor is just
+      /// their gathering.
+      bool is_simple_(const value_t& v) const;
+      /// Turn the current run of simple factors into res_.
+      void flush_();
+
+      const expressionset_impl& rs_;
+      /// The current run of simple factors.
+      values_t factors_;
+      /// The product of the factors before the current run.
+      value_t res_;
+    };
+
     /// Build a left division: `l {\} r`.
     auto ldivide(const value_t& l, const value_t& r) const -> value_t;
 
@@ -396,19 +396,21 @@ namespace vcsn
     // (E+F)G => EG + FG.
     else if (ids_.is_distributive() && l->type() == type_t::add)
       {
-        res = zero();
         // l is a sum, and r might be as well.
+        auto sum = add_builder{*this};
         for (const auto& la: *down_pointer_cast<const add_t>(l))
-          res = add(res, mul(la, r));
+          sum.add(mul(la, r));
+        res = sum.finish();
       }
 
     // E(F+G) => EF + EG.
     else if (ids_.is_distributive() && r->type() == type_t::add)
       {
-        res = zero();
         // r is a sum, l is not.
+        auto sum = add_builder{*this};
         for (const auto& ra: *down_pointer_cast<const add_t>(r))
-          res = add(res, mul(l, ra));
+          sum.add(mul(l, ra));
+        res = sum.finish();
       }
 
     else
@@ -416,6 +418,146 @@ namespace vcsn
     return res;
   }
 
+  /*--------------.
+  | add_builder.  |
+  `--------------*/
+
+  template <typename Context>
+  expressionset_impl<Context>::add_builder::add_builder
+    (const expressionset_impl& rs)
+    : rs_{rs}
+  {}
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::add_builder::add(const value_t& v)
+    -> void
+  {
+    // Without associativity, the shape of the tree matters.
+    if (!rs_.ids_.is_associative())
+      res_ = res_ ? rs_.add(res_, v) : v;
+    // Associativity implies the trivial identities: E+0 => E.
+    else if (!rs_.is_zero(v))
+      rs_.template gather_<type_t::add>(terms_, v);
+  }
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::add_builder::finish()
+    -> value_t
+  {
+    if (!rs_.ids_.is_associative())
+      return res_ ? res_ : rs_.zero();
+    else if (rs_.ids_.is_linear())
+      {
+        // Sort, and merge the runs of equal terms: <h>E+<k>E =>
+        // <h+k>E.
+        std::stable_sort(begin(terms_), end(terms_), less_linear);
+        auto res = values_t{};
+        const auto& ws = *rs_.weightset();
+        for (auto i = begin(terms_), end = std::end(terms_); i != end;)
+          {
+            auto j = std::next(i);
+            if (j == end || less_linear(*i, *j))
+              res.emplace_back(*i);
+            else
+              {
+                auto w = possibly_implicit_lweight_(*i);
+                for (; j != end && !less_linear(*i, *j); ++j)
+                  w = ws.add(w, possibly_implicit_lweight_(*j));
+                if (!ws.is_zero(w))
+                  res.emplace_back(rs_.lweight(w,
+                                               unwrap_possible_lweight_(*i)));
+              }
+            i = j;
+          }
+        return rs_.add_(std::move(res));
+      }
+    else
+      return rs_.add_(std::move(terms_));
+  }
+
+  /*--------------.
+  | mul_builder.  |
+  `--------------*/
+
+  template <typename Context>
+  expressionset_impl<Context>::mul_builder::mul_builder
+    (const expressionset_impl& rs)
+    : rs_{rs}
+  {}
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::mul_builder::is_simple_(const value_t& v) const
+    -> bool
+  {
+    // See mul: none of its identities apply to the product of two
+    // such expressions.
+    switch (v->type())
+      {
+      case type_t::zero:
+      case type_t::one:
+      case type_t::lweight:
+        return false;
+      case type_t::add:
+        return !rs_.ids_.is_distributive();
+      default:
+        return true;
+      }
+  }
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::mul_builder::flush_()
+    -> void
+  {
+    // A run of factors always starts with res_ empty.
+    if (!factors_.empty())
+      {
+        assert(!res_);
+        res_
+          = factors_.size() == 1
+          ? factors_.front()
+          : std::make_shared<mul_t>(std::move(factors_));
+        factors_.clear();
+      }
+  }
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::mul_builder::mul(const value_t& v)
+    -> void
+  {
+    if (!rs_.ids_.is_associative())
+      res_ = res_ ? rs_.mul(res_, v) : v;
+    else if (is_simple_(v)
+             && (!factors_.empty() || !res_ || is_simple_(res_)))
+      {
+        // Start a new run with the product so far.
+        if (res_)
+          {
+            rs_.template gather_<type_t::mul>(factors_, res_);
+            res_ = nullptr;
+          }
+        rs_.template gather_<type_t::mul>(factors_, v);
+      }
+    else
+      {
+        flush_();
+        res_ = res_ ? rs_.mul(res_, v) : v;
+      }
+  }
+
+  template <typename Context>
+  auto
+  expressionset_impl<Context>::mul_builder::finish()
+    -> value_t
+  {
+    flush_();
+    return res_ ? res_ : rs_.one();
+  }
+
   DEFINE::compose(const value_t& l, const value_t& r) const
     -> value_t
   {
@@ -767,6 +909,20 @@ namespace vcsn
     return concat_(l, r, typename is_law<Context>::type{});
   }
 
+  template <typename Context>
+  template <typename Iterator>
+  auto expressionset_impl<Context>::mul_range(Iterator begin,
+                                              Iterator end) const
+    -> value_t
+  {
+    if (begin == end)
+      return one();
+    else if (std::next(begin, 1) == end)
+      return *begin;
+    else
+      return std::make_shared<mul_t>(values_t{begin, end});
+  }
+
   // Concatenation when not LAW.
   DEFINE::concat_(const value_t& l, const value_t& r, std::false_type) const
     -> value_t
@@ -1183,21 +1339,24 @@ namespace vcsn
 
     // [a-c].
     if (accept)
-      for (const auto& cc: ccs)
-        {
-          auto i = std::find(std::begin(gens), std::end(gens), cc.first);
-          auto end = std::find(i, std::end(gens), cc.second);
-          VCSN_REQUIRE(end != std::end(gens),
-                       self(), ": invalid letter interval: ",
-                       to_string(*labelset(), ls.value(std::get<0>(cc))),
-                       '-',
-                       to_string(*labelset(), ls.value(std::get<1>(cc))));
-          for (++end; i != end; ++i)
-            // We want to avoid having (\z + a) + b in case of [ab].
-            res = (is_zero(res)
-                   ? atom(ls.value(*i))
-                   : add(res, atom(ls.value(*i))));
-        }
+      {
+        auto sum = add_builder{*this};
+        for (const auto& cc: ccs)
+          {
+            auto i = std::find(std::begin(gens), std::end(gens), cc.first);
+            auto end = std::find(i, std::end(gens), cc.second);
+            VCSN_REQUIRE(end != std::end(gens),
+                         self(), ": invalid letter interval: ",
+                         to_string(*labelset(), ls.value(std::get<0>(cc))),
+                         '-',
+                         to_string(*labelset(), ls.value(std::get<1>(cc))));
+            // The builder starts with the first letter: we want to
+            // avoid having (\z + a) + b in case of [ab].
+            for (++end; i != end; ++i)
+              sum.add(atom(ls.value(*i)));
+          }
+        res = sum.finish();
+      }
     // [^].
     else if (ccs.empty())
       for (auto l: gens)
@@ -1219,13 +1378,14 @@ namespace vcsn
             for (++end; i != end; ++i)
               accepted.emplace(*i);
           }
+        // The builder starts with the first letter: we want to avoid
+        // having (\z + c) in case of [^ab] (considering
+        // lal_char(abc)).
+        auto sum = add_builder{*this};
         for (auto c: gens)
           if (!has(accepted, c))
-            // We want to avoid having (\z + c) in case of [^ab]
-            // (considering lal_char(abc)).
-            res = (is_zero(res)
-                   ? atom(ls.value(c))
-                   : add(res, atom(ls.value(c))));
+            sum.add(atom(ls.value(c)));
+        res = sum.finish();
       }
     require(!is_zero(res),
             "invalid empty letter class");
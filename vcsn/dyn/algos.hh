@@ -259,6 +259,16 @@ namespace vcsn
     automaton cotrie(const context& ctx, std::istream& is,
                      const std::string& format = "default");
 
+    /// The minimal deterministic automaton of the series contained
+    /// in \a is, built incrementally: same as `trie` then `minimize`,
+    /// but without building the trie.
+    ///
+    /// \param ctx     the (word-based) context used to read the words.
+    /// \param is      the input stream: lexicographically sorted words.
+    /// \param format  the format of the file: "words" or "monomials".
+    automaton dawg(const context& ctx, std::istream& is,
+                   const std::string& format = "default");
+
     /// A simple NFA for (a+b)*a(a+b)^n.
     automaton de_bruijn(const context& ctx, unsigned n);
 
@@ -309,8 +319,11 @@ namespace vcsn
     ///
     /// \param lhs   a LAL automaton
     /// \param rhs   a LAL Boolean automaton
+    /// \param lazy  whether to perform the computations on demand,
+    ///              including the determinization of \a rhs.
     /// \pre \a rhs is Boolean.
-    automaton difference(const automaton& lhs, const automaton& rhs);
+    automaton difference(const automaton& lhs, const automaton& rhs,
+                         bool lazy = false);
 
     /// Words accepted by \a lhs, but not by \a rhs.
     expression difference(const expression& lhs, const expression& rhs);
@@ -331,7 +344,25 @@ namespace vcsn
     weight evaluate(const automaton& aut, const word& l);
 
     /// Evaluate \a p on \a aut.
-    weight evaluate(const automaton& aut, const polynomial& p);
+    ///
+    /// \param aut   the automaton
+    /// \param p     the polynomial of words
+    /// \param algo  how to evaluate its monomials
+    ///   - "monomials": one after the other
+    ///   - "trie": in lexicographic order, sharing the evaluation of
+    ///     their common prefixes.  Requires a free labelset.
+    ///   - "auto": "trie" if the labelset is free, "monomials" otherwise.
+    weight evaluate(const automaton& aut, const polynomial& p,
+                    const std::string& algo = "auto");
+
+    /// Evaluate on \a aut the (weighted) words read from \a is, one
+    /// per line, without loading them.
+    ///
+    /// \param aut     the automaton
+    /// \param is      the stream to read
+    /// \param format  the format of the stream: "words" or "monomials"
+    weight evaluate(const automaton& aut, std::istream& is,
+                    const std::string& format = "default");
 
     /// Distribute product over addition recursively under the starred
     /// subexpressions and group the equal monomials.
@@ -349,6 +380,12 @@ namespace vcsn
     /// The subautomaton based on \a aut, with only states in \a ss visible.
     automaton filter(const automaton& aut, const std::vector<unsigned>& ss);
 
+    /// Build an automaton of context \a ctx from flat arrays.
+    ///
+    /// \param ctx     the context of the result
+    /// \param arrays  the states, transitions and weights.
+    automaton from_arrays(const context& ctx, const automaton_arrays& arrays);
+
     /// Focus on a specific tape of a tupleset automaton.
     automaton focus(const automaton& aut, unsigned tape);
 
@@ -595,6 +632,30 @@ namespace vcsn
                                  unsigned num = 1,
                                  const std::string& algo = "auto");
 
+    /// An enumerator of the paths of \a aut, lightest first.
+    ///
+    /// Paths are computed on demand (lazy Eppstein algorithm), so
+    /// the first ones are available without bounding their number.
+    ///
+    /// \pre the weightset of \a aut is tropical (nmin, rmin, zmin).
+    lightest_iterator lightest_iter(const automaton& aut);
+
+    /// A matcher for \a exp, to evaluate and search many words.
+    ///
+    /// \param exp       an expression on letters.
+    /// \param capacity  the maximum number of cached states of the
+    ///                  underlying deterministic automata.
+    /// \param algo      how to match:
+    ///   - "auto": same as "deterministic"
+    ///   - "bitparallel": simulate the standard automaton of \a exp
+    ///     with bit masks.  Requires a Boolean expression; falls back
+    ///     to "deterministic" if \a exp has extended operators, or
+    ///     too many atoms.
+    ///   - "deterministic": deterministic derived terms, computed lazily.
+    expression_matcher matcher(const expression& exp,
+                               unsigned capacity = 1024,
+                               const std::string& algo = "auto");
+
     /// Read an automaton from a string.
     /// \param data    the input string.
     /// \param format  its format.
@@ -731,6 +792,15 @@ namespace vcsn
     /// Build the pair automaton of the given automaton
     automaton pair(const automaton& aut, bool keep_initials = false);
 
+    /// An index to answer many lightest path queries on \a aut.
+    ///
+    /// \param aut        a tropical automaton without negative weights,
+    ///                   which must not be modified afterwards.
+    /// \param landmarks  the number of landmark states, whose distances
+    ///                   guide the "alt" queries.
+    lightest_path_index path_index(const automaton& aut,
+                                   unsigned landmarks = 4);
+
     /// Create a partial identity transducer from \a aut.
     automaton partial_identity(const automaton& aut);
 
@@ -991,6 +1061,20 @@ namespace vcsn
     /// The right-multiplication of a polynomial with \a w as weight.
     polynomial rweight(const polynomial& p, const weight& w);
 
+    /// Random words of \a aut.
+    ///
+    /// \param aut     an automaton on letters, Boolean, or whose weights
+    ///                are non-negative (r or log).
+    /// \param num     the number of words to draw.
+    /// \param length  the length of the words, or -1 for any length.
+    ///
+    /// On Boolean automata, the words are drawn uniformly among the
+    /// accepted words of length \a length, which is required.
+    /// Otherwise, they are drawn with a probability proportional to
+    /// their weight.
+    std::vector<word> sample(const automaton& aut, unsigned num,
+                             int length = -1);
+
     /// Build the SCC automaton whose states are labeled with number
     /// of the strongly-connected component they belong to.
     ///
@@ -1098,6 +1182,11 @@ namespace vcsn
     automaton to_automaton(const expression& exp,
                            const std::string& algo = "auto");
 
+    /// The states, transitions and weights of \a aut as flat arrays.
+    ///
+    /// \param aut   an automaton whose weights are numbers.
+    automaton_arrays to_arrays(const automaton& aut);
+
     /// First order development of a \a exp.
     ///
     /// \param exp              the input expression
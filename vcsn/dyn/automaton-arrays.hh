@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vcsn
+{
+  namespace dyn
+  {
+    /// The structure of an automaton, as flat arrays, one entry per
+    /// transition, suitable for bulk exchanges (e.g., with NumPy).
+    ///
+    /// States are numbered from 0 to `states.size() - 1`.  Initial
+    /// and final weights are transitions whose source (respectively
+    /// destination) is -1, and whose label is -1.
+    struct automaton_arrays
+    {
+      /// For each state number, the state in the automaton (as
+      /// displayed, e.g., by `format`).
+      std::vector<int32_t> states;
+      /// The source of each transition, or -1 for initial weights.
+      std::vector<int32_t> sources;
+      /// The destination of each transition, or -1 for final weights.
+      std::vector<int32_t> destinations;
+      /// The label of each transition, as an index in label_names, or
+      /// -1 for initial and final weights.
+      std::vector<int32_t> labels;
+      /// The weight of each transition.
+      std::vector<double> weights;
+      /// The labels, as strings.
+      std::vector<std::string> label_names;
+    };
+  }
+}
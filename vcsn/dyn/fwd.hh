@@ -10,9 +10,21 @@ namespace vcsn
     // vcsn/dyn/automaton.hh.
     class automaton;
 
+    // vcsn/dyn/automaton-arrays.hh.
+    struct automaton_arrays;
+
     // vcsn/dyn/context.hh.
     class context;
 
+    // vcsn/dyn/lightest-iterator.hh.
+    class lightest_iterator;
+
+    // vcsn/dyn/matcher.hh.
+    class expression_matcher;
+
+    // vcsn/dyn/path-index.hh.
+    class lightest_path_index;
+
     // vcsn/dyn/types.hh.
     using identities = ::vcsn::rat::identities;
 
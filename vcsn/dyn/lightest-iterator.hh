@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory> // shared_ptr
+
+#include <boost/optional.hpp>
+
+#include <vcsn/dyn/fwd.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/misc/export.hh>
+
+namespace vcsn
+{
+  namespace dyn
+  {
+    /// A dyn enumerator of the lightest paths of an automaton.
+    ///
+    /// Paths are computed on demand, lightest first.
+    class LIBVCSN_API lightest_iterator
+    {
+    public:
+      /// Abstract wrapped typed enumerator.
+      struct base
+      {
+        virtual ~base() = default;
+        virtual boost::optional<polynomial> next() = 0;
+      };
+
+      template <typename Impl>
+      lightest_iterator(const std::shared_ptr<Impl>& self)
+        : self_(self)
+      {}
+
+      /// The next path, as a monomial, if there is one.
+      boost::optional<polynomial> next()
+      {
+        return self_->next();
+      }
+
+    private:
+      /// The wrapped enumerator.
+      std::shared_ptr<base> self_;
+    };
+  }
+}
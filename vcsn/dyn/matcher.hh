@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory> // shared_ptr
+#include <vector>
+
+#include <vcsn/dyn/context.hh>
+#include <vcsn/dyn/fwd.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/misc/export.hh>
+
+namespace vcsn
+{
+  namespace dyn
+  {
+    /// A dyn matcher: evaluates words against an expression, with a
+    /// bounded cache of deterministic derived terms, or bit-parallelism.
+    class LIBVCSN_API expression_matcher
+    {
+    public:
+      /// Abstract wrapped typed matcher.
+      struct base
+      {
+        virtual ~base() = default;
+        virtual dyn::context context() const = 0;
+        virtual weight match(const label& w) = 0;
+        virtual std::vector<weight> match(const std::vector<label>& ws) = 0;
+        virtual weight search(const label& w) = 0;
+        virtual std::vector<weight> search(const std::vector<label>& ws) = 0;
+        virtual size_t size() const = 0;
+      };
+
+      template <typename Impl>
+      expression_matcher(const std::shared_ptr<Impl>& self)
+        : self_(self)
+      {}
+
+      /// The context of the expression.
+      dyn::context context() const
+      {
+        return self_->context();
+      }
+
+      /// The weight of word \a w.
+      weight match(const label& w)
+      {
+        return self_->match(w);
+      }
+
+      /// The weights of the words \a ws.
+      std::vector<weight> match(const std::vector<label>& ws)
+      {
+        return self_->match(ws);
+      }
+
+      /// The sum of the weights of the factors of \a w.
+      weight search(const label& w)
+      {
+        return self_->search(w);
+      }
+
+      /// The sums of the weights of the factors of \a ws.
+      std::vector<weight> search(const std::vector<label>& ws)
+      {
+        return self_->search(ws);
+      }
+
+      /// The number of cached states, or of positions for bit-parallel
+      /// matchers.
+      size_t size() const
+      {
+        return self_->size();
+      }
+
+    private:
+      /// The wrapped matcher.
+      std::shared_ptr<base> self_;
+    };
+  }
+}
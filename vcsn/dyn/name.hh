@@ -147,6 +147,8 @@ namespace vcsn
 
   DEFINE(vcsn::rat::identities);
   DEFINE(vcsn::direction);
+
+  DEFINE(const vcsn::dyn::automaton_arrays);
 #undef DEFINE
 
 
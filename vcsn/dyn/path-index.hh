@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory> // shared_ptr
+#include <string>
+
+#include <vcsn/dyn/fwd.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/misc/export.hh>
+
+namespace vcsn
+{
+  namespace dyn
+  {
+    /// A dyn index to answer lightest path queries on an automaton.
+    class LIBVCSN_API lightest_path_index
+    {
+    public:
+      /// Abstract wrapped typed index.
+      struct base
+      {
+        virtual ~base() = default;
+        virtual polynomial query(unsigned src, unsigned dst,
+                                 const std::string& algo) = 0;
+      };
+
+      template <typename Impl>
+      lightest_path_index(const std::shared_ptr<Impl>& self)
+        : self_(self)
+      {}
+
+      /// The lightest path from state \a src to state \a dst, as a
+      /// monomial (or the empty polynomial if there is none).
+      polynomial query(unsigned src, unsigned dst,
+                       const std::string& algo = "auto")
+      {
+        return self_->query(src, dst, algo);
+      }
+
+    private:
+      /// The wrapped index.
+      std::shared_ptr<base> self_;
+    };
+  }
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <vcsn/labelset/fwd.hh>
+#include <vcsn/misc/functional.hh> // vcsn::less
+#include <vcsn/misc/type_traits.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /// A map from labels to \a Value, for letterset<GenSet> whose
+    /// letters have a dense index (e.g., range_alphabet): lookups
+    /// are array accesses, and iteration is in label order, as with
+    /// std::map.
+    ///
+    /// Supports the subset of the std::map interface used by
+    /// algorithms: find, emplace, operator[], and iteration.
+    template <typename LabelSet, typename Value>
+    class dense_label_map
+    {
+    public:
+      using labelset_t = LabelSet;
+      using genset_t = typename labelset_t::genset_t;
+      using key_type = typename labelset_t::value_t;
+      using mapped_type = Value;
+      using value_type = std::pair<const key_type, mapped_type>;
+
+    private:
+      /// The entries, in insertion order.
+      using entries_t = std::vector<value_type>;
+      entries_t entries_;
+      /// Label index -> 1 + position in entries_, or 0 if absent.
+      std::array<unsigned, genset_t::dense_size()> index_ = {};
+
+    public:
+      /// Iterate over the entries, in label order.
+      template <typename Map, typename Entry>
+      class iterator_impl
+        : public std::iterator<std::forward_iterator_tag, Entry>
+      {
+      public:
+        iterator_impl(Map& map, size_t i)
+          : map_{&map}
+          , i_{i}
+        {
+          skip_();
+        }
+
+        Entry& operator*() const
+        {
+          return map_->entries_[map_->index_[i_] - 1];
+        }
+
+        Entry* operator->() const
+        {
+          return &**this;
+        }
+
+        iterator_impl& operator++()
+        {
+          ++i_;
+          skip_();
+          return *this;
+        }
+
+        bool operator==(const iterator_impl& that) const
+        {
+          return i_ == that.i_;
+        }
+
+        bool operator!=(const iterator_impl& that) const
+        {
+          return !(*this == that);
+        }
+
+      private:
+        /// Move to the next present entry.
+        void skip_()
+        {
+          while (i_ < genset_t::dense_size() && !map_->index_[i_])
+            ++i_;
+        }
+
+        Map* map_;
+        size_t i_;
+      };
+
+      using iterator = iterator_impl<dense_label_map, value_type>;
+      using const_iterator
+        = iterator_impl<const dense_label_map, const value_type>;
+
+      iterator begin()              { return {*this, 0}; }
+      iterator end()                { return {*this, genset_t::dense_size()}; }
+      const_iterator begin() const  { return {*this, 0}; }
+      const_iterator end() const    { return {*this, genset_t::dense_size()}; }
+
+      bool empty() const
+      {
+        return entries_.empty();
+      }
+
+      size_t size() const
+      {
+        return entries_.size();
+      }
+
+      iterator find(const key_type& k)
+      {
+        auto i = genset_t::index(k);
+        return {*this, index_[i] ? i : genset_t::dense_size()};
+      }
+
+      const_iterator find(const key_type& k) const
+      {
+        auto i = genset_t::index(k);
+        return {*this, index_[i] ? i : genset_t::dense_size()};
+      }
+
+      /// Insert \a k -> \a v, unless \a k is already mapped.
+      std::pair<iterator, bool> emplace(const key_type& k, mapped_type v)
+      {
+        auto i = genset_t::index(k);
+        bool res = !index_[i];
+        if (res)
+          {
+            entries_.emplace_back(k, std::move(v));
+            index_[i] = entries_.size();
+          }
+        return {{*this, i}, res};
+      }
+
+      mapped_type& operator[](const key_type& k)
+      {
+        auto i = genset_t::index(k);
+        if (!index_[i])
+          {
+            entries_.emplace_back(k, mapped_type{});
+            index_[i] = entries_.size();
+          }
+        return entries_[index_[i] - 1].second;
+      }
+    };
+
+    /// The type of maps from labels of \a LabelSet to \a Value,
+    /// ordered as the labels.
+    template <typename LabelSet, typename Value, typename = void_t<>>
+    struct label_map
+    {
+      using type = std::map<typename LabelSet::value_t, Value,
+                            vcsn::less<LabelSet>>;
+    };
+
+    template <typename GenSet, typename Value>
+    struct label_map<letterset<GenSet>, Value,
+                     void_t<decltype(GenSet::dense_size())>>
+    {
+      using type = dense_label_map<letterset<GenSet>, Value>;
+    };
+  }
+
+  /// An ordered map from labels of \a LabelSet to \a Value: an array
+  /// if the labels have a dense index, a std::map otherwise.
+  template <typename LabelSet, typename Value>
+  using label_map_t = typename detail::label_map<LabelSet, Value>::type;
+}
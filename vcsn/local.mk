@@ -16,6 +16,7 @@ algo_headers =                                  \
   %D%/algos/accessible.hh                       \
   %D%/algos/add.hh                              \
   %D%/algos/are-equivalent.hh                   \
+  %D%/algos/arrays.hh                           \
   %D%/algos/are-isomorphic.hh                   \
   %D%/algos/bellman-ford.hh                     \
   %D%/algos/cerny.hh                            \
@@ -32,9 +33,11 @@ algo_headers =                                  \
   %D%/algos/constant.hh                         \
   %D%/algos/copy.hh                             \
   %D%/algos/daut.hh                             \
+  %D%/algos/dawg.hh                             \
   %D%/algos/de-bruijn.hh                        \
   %D%/algos/derivation.hh                       \
   %D%/algos/derived-term.hh                     \
+  %D%/algos/detail/path-tree.hh                 \
   %D%/algos/detail/printer.hh                   \
   %D%/algos/determinize-expansion.hh            \
   %D%/algos/determinize.hh                      \
@@ -83,11 +86,13 @@ algo_headers =                                  \
   %D%/algos/ladybird.hh                         \
   %D%/algos/letterize.hh                        \
   %D%/algos/levenshtein.hh                      \
+  %D%/algos/lexicon.hh                          \
   %D%/algos/lift.hh                             \
   %D%/algos/lightest-automaton.hh               \
   %D%/algos/lightest-path.hh                    \
   %D%/algos/lightest.hh                         \
   %D%/algos/make-context.hh                     \
+  %D%/algos/matcher.hh                          \
   %D%/algos/minimize-brzozowski.hh              \
   %D%/algos/minimize-hopcroft.hh                \
   %D%/algos/minimize-moore.hh                   \
@@ -102,7 +107,9 @@ algo_headers =                                  \
   %D%/algos/pair.hh                             \
   %D%/algos/partial-identity-expression.hh      \
   %D%/algos/partial-identity.hh                 \
+  %D%/algos/path-index.hh                       \
   %D%/algos/path.hh                             \
+  %D%/algos/positions.hh                        \
   %D%/algos/prefix.hh                           \
   %D%/algos/print.hh                            \
   %D%/algos/project-automaton.hh                \
@@ -117,6 +124,7 @@ algo_headers =                                  \
   %D%/algos/read-automaton.hh                   \
   %D%/algos/read.hh                             \
   %D%/algos/reduce.hh                           \
+  %D%/algos/sample.hh                           \
   %D%/algos/scc.hh                              \
   %D%/algos/shortest-path-tree.hh               \
   %D%/algos/shortest.hh                         \
@@ -150,6 +158,7 @@ algo_headers =                                  \
 nobase_include_HEADERS =                        \
   $(algo_headers)                               \
   %D%/alphabets/char.hh                         \
+  %D%/alphabets/rangealpha.hh                   \
   %D%/alphabets/setalpha.hh                     \
   %D%/alphabets/string.hh                       \
   %D%/concepts/automaton.hh                     \
@@ -221,15 +230,20 @@ nobase_include_HEADERS =                        \
   %D%/dyn/algos.hh                              \
   %D%/dyn/algos.hxx                             \
   %D%/dyn/automaton.hh                          \
+  %D%/dyn/automaton-arrays.hh                   \
   %D%/dyn/cast.hh                               \
   %D%/dyn/context.hh                            \
   %D%/dyn/fwd.hh                                \
+  %D%/dyn/lightest-iterator.hh                  \
+  %D%/dyn/matcher.hh                            \
   %D%/dyn/name.hh                               \
+  %D%/dyn/path-index.hh                         \
   %D%/dyn/types.hh                              \
   %D%/dyn/value.hh                              \
   %D%/fwd.hh                                    \
   %D%/labelset/fwd.hh                           \
   %D%/labelset/genset-labelset.hh               \
+  %D%/labelset/label-map.hh                     \
   %D%/labelset/labelset.hh                      \
   %D%/labelset/letterset.hh                     \
   %D%/labelset/nullableset.hh                   \
@@ -268,13 +282,16 @@ nobase_include_HEADERS =                        \
   %D%/misc/iostream.hh                          \
   %D%/misc/irange.hh                            \
   %D%/misc/location.hh                          \
+  %D%/misc/lru-cache.hh                         \
   %D%/misc/map.hh                               \
   %D%/misc/math.hh                              \
   %D%/misc/memory.hh                            \
   %D%/misc/military-order.hh                    \
   %D%/misc/pair.hh                              \
+  %D%/misc/portfolio.hh                         \
   %D%/misc/position.hh                          \
   %D%/misc/queue.hh                             \
+  %D%/misc/radix_heap.hh                        \
   %D%/misc/raise.hh                             \
   %D%/misc/random.hh                            \
   %D%/misc/regex.hh                             \
@@ -287,6 +304,7 @@ nobase_include_HEADERS =                        \
   %D%/misc/star-status.hh                       \
   %D%/misc/static-if.hh                         \
   %D%/misc/stream.hh                            \
+  %D%/misc/string-id.hh                         \
   %D%/misc/symbol.hh                            \
   %D%/misc/to-string.hh                         \
   %D%/misc/to.hh                                \
@@ -308,11 +326,13 @@ nobase_include_HEADERS =                        \
   %D%/weightset/nmin.hh                         \
   %D%/weightset/polynomialset.hh                \
   %D%/weightset/q.hh                            \
+  %D%/weightset/qh.hh                           \
   %D%/weightset/qmp.hh                          \
   %D%/weightset/r.hh                            \
   %D%/weightset/rmin.hh                         \
   %D%/weightset/weightset.hh                    \
   %D%/weightset/z.hh                            \
+  %D%/weightset/zh.hh                           \
   %D%/weightset/zmin.hh
 
 # Unfortunately Automake 1.14 does not generate this for us.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/heap/d_ary_heap.hpp>
 #include <boost/heap/fibonacci_heap.hpp>
 
 namespace vcsn
@@ -29,4 +30,13 @@ namespace vcsn
 
   template <typename Elt>
   using max_fibonacci_heap = boost::heap::fibonacci_heap<Elt>;
+
+  /// A 4-ary heap, with decrease-key.  Stored in a vector, it does
+  /// not allocate per element, and is usually faster than the
+  /// Fibonacci heap, but Elt must be copy-assignable.
+  template <typename Elt>
+  using min_d_ary_heap
+    = boost::heap::d_ary_heap<Elt, boost::heap::arity<4>,
+                              boost::heap::mutable_<true>,
+                              detail::comparator_t<Elt>>;
 }
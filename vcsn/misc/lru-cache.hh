@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cassert>
+#include <functional> // equal_to
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace vcsn
+{
+  /// A map of bounded size: when full, inserting a new entry evicts
+  /// the least recently used one.
+  ///
+  /// Keeps track of the number of successful (hits) and failed
+  /// (misses) lookups.
+  template <typename Key, typename Value,
+            typename Hash = std::hash<Key>,
+            typename KeyEqual = std::equal_to<Key>>
+  class lru_cache
+  {
+  public:
+    using key_t = Key;
+    using value_t = Value;
+
+    /// \param capacity  the maximum number of entries.
+    lru_cache(size_t capacity = 10000)
+      : capacity_{capacity}
+    {
+      assert(capacity_);
+    }
+
+    /// The value of \a k, if cached, and then mark it as most
+    /// recently used.  Otherwise nullptr.
+    ///
+    /// The result is valid until the next call to `emplace`.
+    const value_t* find(const key_t& k)
+    {
+      auto i = map_.find(k);
+      if (i == end(map_))
+        {
+          ++misses_;
+          return nullptr;
+        }
+      else
+        {
+          ++hits_;
+          list_.splice(begin(list_), list_, i->second);
+          return &i->second->second;
+        }
+    }
+
+    /// Cache the value \a v for \a k, possibly evicting the least
+    /// recently used entry.
+    ///
+    /// \pre k is not in the cache.
+    const value_t& emplace(const key_t& k, value_t v)
+    {
+      assert(!map_.count(k));
+      if (map_.size() == capacity_)
+        {
+          map_.erase(list_.back().first);
+          list_.pop_back();
+        }
+      list_.emplace_front(k, std::move(v));
+      map_.emplace(k, begin(list_));
+      return list_.front().second;
+    }
+
+    /// Forget all the entries, but not the statistics.
+    void clear()
+    {
+      map_.clear();
+      list_.clear();
+    }
+
+    /// The number of entries.
+    size_t size() const
+    {
+      return map_.size();
+    }
+
+    /// The maximum number of entries.
+    size_t capacity() const
+    {
+      return capacity_;
+    }
+
+    /// The number of successful lookups.
+    size_t hits() const
+    {
+      return hits_;
+    }
+
+    /// The number of failed lookups.
+    size_t misses() const
+    {
+      return misses_;
+    }
+
+  private:
+    /// The entries, most recently used first.
+    using list_t = std::list<std::pair<key_t, value_t>>;
+    list_t list_;
+    /// Key to entry.
+    std::unordered_map<key_t, typename list_t::iterator, Hash, KeyEqual> map_;
+    size_t capacity_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+  };
+}
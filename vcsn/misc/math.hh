@@ -7,15 +7,16 @@ namespace vcsn
 {
   namespace detail
   {
-    /// Greatest common divisor.
+    /// Greatest common divisor of two non-negative integers.
+    template <typename Int>
     ATTRIBUTE_PURE
     inline
-    unsigned int gcd(unsigned int a, unsigned int b)
+    Int gcd(Int a, Int b)
     {
       require(b, "gcd: rhs cannot be zero");
       while (b)
       {
-        unsigned int t = a;
+        Int t = a;
         a = b;
         b = t % b;
       }
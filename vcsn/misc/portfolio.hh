@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <vcsn/misc/raise.hh>
+
+namespace vcsn
+{
+  /// Thrown by the variants of a portfolio that give up.
+  struct portfolio_cancelled
+  {};
+
+  namespace detail
+  {
+    /// The cancellation flag of the current thread, if it runs a
+    /// variant of a portfolio.
+    inline std::atomic<bool>*& portfolio_flag()
+    {
+      static thread_local std::atomic<bool>* res = nullptr;
+      return res;
+    }
+  }
+
+  /// Give up if the current thread runs a variant of a portfolio
+  /// that is no longer needed.  Cheap: to be called periodically by
+  /// long computations.
+  inline void portfolio_poll()
+  {
+    auto f = detail::portfolio_flag();
+    if (f && f->load(std::memory_order_relaxed))
+      throw portfolio_cancelled{};
+  }
+
+  /// Run several variants of an algorithm concurrently, and keep one
+  /// result.
+  ///
+  /// Each variant is run in its own thread, so they must not share
+  /// mutable data (e.g., give each variant its own copy of an
+  /// automaton to work in place).  A variant gives up by throwing
+  /// portfolio_cancelled, for instance via portfolio_poll() or
+  /// control::check().  If all the variants fail, the error of the
+  /// first one is rethrown.
+  ///
+  /// \tparam Result  the type of the result of the variants
+  template <typename Result>
+  class portfolio
+  {
+  public:
+    using result_t = Result;
+    /// The lower, the better.
+    using score_t = size_t;
+
+    /// The view of the portfolio given to a variant.
+    class control
+    {
+    public:
+      control(const portfolio& p, unsigned index)
+        : portfolio_(p)
+        , index_(index)
+      {}
+
+      /// Whether hopeless() may hold, i.e., whether some variant
+      /// already has a result.  Cheap.
+      bool bounded() const
+      {
+        return (portfolio_.best_score_.load(std::memory_order_relaxed)
+                != std::numeric_limits<score_t>::max());
+      }
+
+      /// Whether some other variant already has a result at least
+      /// as good as a result of score \a s from this variant.
+      bool hopeless(score_t s) const
+      {
+        return portfolio_.hopeless_(index_, s);
+      }
+
+      /// Give up if hopeless(s), or if cancelled.
+      void check(score_t s) const
+      {
+        if (hopeless(s))
+          throw portfolio_cancelled{};
+        portfolio_poll();
+      }
+
+    private:
+      const portfolio& portfolio_;
+      unsigned index_;
+    };
+
+    using variant_t = std::function<result_t(const control&)>;
+
+    /// Add a variant.
+    portfolio& add(variant_t v)
+    {
+      variants_.emplace_back(std::move(v));
+      return *this;
+    }
+
+    /// Run all the variants, and return the result with the smallest
+    /// score.  Ties are broken by the order of the variants, so the
+    /// result does not depend on the scheduling.
+    ///
+    /// \param score  the score of a result
+    template <typename Score>
+    result_t best(Score score)
+    {
+      return run_([this, &score](unsigned i, result_t&& r)
+                  {
+                    auto s = score(r);
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    auto best_score = best_score_.load();
+                    if (!result_
+                        || std::tie(s, i) < std::tie(best_score, best_))
+                      {
+                        result_ = std::move(r);
+                        best_ = i;
+                        best_score_ = s;
+                      }
+                  });
+    }
+
+    /// Run all the variants, and return the result of the first one
+    /// to complete.  The others are cancelled: they stop at their
+    /// next portfolio_poll().
+    result_t first()
+    {
+      return run_([this](unsigned i, result_t&& r)
+                  {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    if (!result_)
+                      {
+                        result_ = std::move(r);
+                        best_ = i;
+                        for (unsigned j = 0; j < flags_.size(); ++j)
+                          if (j != i)
+                            flags_[j] = true;
+                      }
+                  });
+    }
+
+  private:
+    /// Run the variants, and pass their results to \a done.
+    template <typename Done>
+    result_t run_(Done done)
+    {
+      result_ = boost::none;
+      best_ = 0;
+      best_score_ = std::numeric_limits<score_t>::max();
+      auto n = unsigned(variants_.size());
+      flags_ = std::vector<std::atomic<bool>>(n);
+      for (auto& f: flags_)
+        f = false;
+      auto errors = std::vector<std::exception_ptr>(n);
+
+      auto run = [&](unsigned i)
+        {
+          detail::portfolio_flag() = &flags_[i];
+          try
+            {
+              done(i, variants_[i](control{*this, i}));
+            }
+          catch (const portfolio_cancelled&)
+            {}
+          catch (...)
+            {
+              errors[i] = std::current_exception();
+            }
+          detail::portfolio_flag() = nullptr;
+        };
+
+      if (n <= 1 || std::thread::hardware_concurrency() <= 1)
+        for (unsigned i = 0; i < n; ++i)
+          run(i);
+      else
+        {
+          // The first variant runs in the current thread.
+          auto threads = std::vector<std::thread>{};
+          for (unsigned i = 1; i < n; ++i)
+            threads.emplace_back(run, i);
+          run(0);
+          for (auto& t: threads)
+            t.join();
+        }
+
+      if (!result_)
+        for (const auto& e: errors)
+          if (e)
+            std::rethrow_exception(e);
+      require(bool(result_), "portfolio: all the variants gave up");
+      return std::move(*result_);
+    }
+
+    /// Whether variant \a i, with a result of score \a s, cannot win.
+    bool hopeless_(unsigned i, score_t s) const
+    {
+      // Unlocked read, just to save the lock in the common case.
+      if (best_score_.load(std::memory_order_relaxed) > s)
+        return false;
+      std::lock_guard<std::mutex> lock{mutex_};
+      auto best_score = best_score_.load();
+      return result_ && std::tie(best_score, best_) <= std::tie(s, i);
+    }
+
+    std::vector<variant_t> variants_;
+    /// The cancellation flags of the variants.
+    std::vector<std::atomic<bool>> flags_;
+
+    mutable std::mutex mutex_;
+    /// The result so far.
+    boost::optional<result_t> result_;
+    /// Its variant.
+    unsigned best_ = 0;
+    /// Its score.
+    std::atomic<score_t> best_score_;
+  };
+}
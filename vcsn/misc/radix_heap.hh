@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vcsn
+{
+  /// A monotone priority queue on integral keys: a radix heap.
+  ///
+  /// The popped keys are nondecreasing, which is the case of
+  /// Dijkstra's algorithm on non-negative weights: pushed keys should
+  /// not be smaller than the last popped key.  Such keys are
+  /// nevertheless accepted, and treated as equal to it.
+  ///
+  /// Elements are stored in buckets of increasing key ranges, with
+  /// no allocation per element: an element moves down at most once
+  /// per bit of its key, so push and pop cost O(log C) amortized,
+  /// where C is the largest difference between two keys.
+  ///
+  /// Based on `Faster algorithms for the shortest path problem`,
+  /// Ahuja, Mehlhorn, Orlin and Tarjan (1990).
+  template <typename Key, typename Value>
+  class min_radix_heap
+  {
+  public:
+    using key_t = Key;
+    using value_t = Value;
+
+    static_assert(std::is_integral<key_t>::value,
+                  "radix_heap: requires integral keys");
+
+    bool empty() const
+    {
+      return size_ == 0;
+    }
+
+    size_t size() const
+    {
+      return size_;
+    }
+
+    /// Insert \a v with key \a k.
+    template <typename... Args>
+    void emplace(key_t k, Args&&... args)
+    {
+      auto u = to_unsigned_(k);
+      buckets_[bucket_(u)].emplace_back(u, value_t(std::forward<Args>(args)...));
+      ++size_;
+    }
+
+    /// The key of the lightest element.
+    key_t top_key()
+    {
+      refill_();
+      return to_key_(buckets_[0].back().first);
+    }
+
+    /// The lightest element.
+    const value_t& top()
+    {
+      refill_();
+      return buckets_[0].back().second;
+    }
+
+    /// Remove the lightest element.
+    void pop()
+    {
+      refill_();
+      buckets_[0].pop_back();
+      --size_;
+    }
+
+  private:
+    /// Keys, mapped to unsigned integers preserving the order.
+    using ukey_t = std::make_unsigned_t<key_t>;
+    using entry_t = std::pair<ukey_t, value_t>;
+
+    static ukey_t to_unsigned_(key_t k)
+    {
+      return ukey_t(k) - ukey_t(std::numeric_limits<key_t>::min());
+    }
+
+    static key_t to_key_(ukey_t u)
+    {
+      return key_t(u + ukey_t(std::numeric_limits<key_t>::min()));
+    }
+
+    /// The number of significant bits of \a u.
+    static unsigned bit_width_(ukey_t u)
+    {
+#if defined __clang__ || defined __GNUC__
+      using ull = unsigned long long;
+      return u ? std::numeric_limits<ull>::digits - __builtin_clzll(ull(u)) : 0;
+#else
+      unsigned res = 0;
+      for (; u; u >>= 1)
+        ++res;
+      return res;
+#endif
+    }
+
+    /// The bucket of a key: the position of the highest bit on which
+    /// it differs from the last popped key.
+    size_t bucket_(ukey_t u) const
+    {
+      return last_ < u ? bit_width_(u ^ last_) : 0;
+    }
+
+    /// Make sure that bucket 0 is not empty: redistribute the first
+    /// non-empty bucket, using its minimum as last popped key.
+    void refill_()
+    {
+      assert(!empty());
+      if (buckets_[0].empty())
+        {
+          size_t i = 1;
+          while (buckets_[i].empty())
+            ++i;
+          auto& b = buckets_[i];
+          last_ = b.front().first;
+          for (const auto& e: b)
+            if (e.first < last_)
+              last_ = e.first;
+          // All the elements move to lower buckets.
+          for (auto& e: b)
+            buckets_[bucket_(e.first)].emplace_back(std::move(e));
+          b.clear();
+        }
+    }
+
+    /// Bucket i > 0 contains the keys that first differ from last_ on
+    /// bit i - 1.  Bucket 0 contains the keys equal to last_ (or
+    /// smaller, see above).
+    std::array<std::vector<entry_t>, std::numeric_limits<ukey_t>::digits + 1>
+      buckets_;
+    /// The last popped key.
+    ukey_t last_ = 0;
+    size_t size_ = 0;
+  };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <functional> // std::hash
+#include <iosfwd>
+#include <string>
+
+#include <vcsn/misc/export.hh>
+
+namespace vcsn
+{
+  /// An internalized string, represented by a 32-bit id in a
+  /// process-wide table.
+  ///
+  /// Contrary to symbol, comparisons and hashing are integer
+  /// operations: the string itself is needed only for I/O.  Ids are
+  /// allocated in order of first occurrence in the process, so the
+  /// order of string_ids is *not* the lexicographical order of their
+  /// strings, and depends on the strings that were interned before
+  /// (by any context, alphabet or automaton).  Compare the get()s to
+  /// order alphabetically.
+  ///
+  /// The table lives in libvcsn, so that ids are shared by all the
+  /// modules (see symbol).
+  class LIBVCSN_API string_id
+  {
+  public:
+    using id_t = uint32_t;
+
+    /// The empty string, whose id is 0.
+    string_id() = default;
+
+    string_id(const std::string& s)
+      : id_{intern_(s)}
+    {}
+
+    string_id(const char* s)
+      : string_id{std::string{s}}
+    {}
+
+    /// The id of this string.
+    id_t id() const
+    {
+      return id_;
+    }
+
+    /// The corresponding string.
+    const std::string& get() const
+    {
+      return get_(id_);
+    }
+
+    operator const std::string&() const
+    {
+      return get();
+    }
+
+    friend bool operator==(string_id l, string_id r)
+    {
+      return l.id_ == r.id_;
+    }
+
+    friend bool operator!=(string_id l, string_id r)
+    {
+      return l.id_ != r.id_;
+    }
+
+    /// Order of interning, see the class documentation.
+    friend bool operator<(string_id l, string_id r)
+    {
+      return l.id_ < r.id_;
+    }
+
+    friend bool operator<=(string_id l, string_id r)
+    {
+      return l.id_ <= r.id_;
+    }
+
+    friend bool operator>(string_id l, string_id r)
+    {
+      return l.id_ > r.id_;
+    }
+
+    friend bool operator>=(string_id l, string_id r)
+    {
+      return l.id_ >= r.id_;
+    }
+
+  private:
+    /// The id of \a s, allocated if needed.
+    static id_t intern_(const std::string& s);
+    /// The string whose id is \a i.
+    static const std::string& get_(id_t i);
+
+    id_t id_ = 0;
+  };
+
+  LIBVCSN_API
+  std::ostream& operator<<(std::ostream& o, string_id s);
+}
+
+namespace std
+{
+  template <>
+  struct hash<vcsn::string_id>
+  {
+    size_t operator()(vcsn::string_id s) const
+    {
+      return hash<vcsn::string_id::id_t>{}(s.id());
+    }
+  };
+}
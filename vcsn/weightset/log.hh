@@ -85,6 +85,31 @@ namespace vcsn
       return is_zero(l) || is_zero(r) ? zero() : l + r;
     }
 
+    /// res[i] = res[i] + v[i], for i in [0, n).
+    ///
+    /// Sums with zero (+oo) are frequent in sparse rows, and, unlike
+    /// in add, cost no call to log1p and exp.
+    template <typename OutIt, typename InIt>
+    static void add_n(OutIt res, InIt v, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+        if (!is_zero(v[i]))
+          res[i] = is_zero(res[i]) ? v[i] : add(res[i], v[i]);
+    }
+
+    /// res[i] = res[i] + a * x[i], for i in [0, n).
+    template <typename OutIt, typename InIt>
+    static void axpy(OutIt res, const value_t a, InIt x, size_t n)
+    {
+      if (!is_zero(a))
+        for (size_t i = 0; i < n; ++i)
+          if (!is_zero(x[i]))
+            {
+              auto w = a + x[i];
+              res[i] = is_zero(res[i]) ? w : add(res[i], w);
+            }
+    }
+
     value_t
     rdivide(const value_t l, const value_t r) const
     {
@@ -40,6 +40,41 @@ namespace vcsn
                 : l + r);
       }
 
+      /// res[i] = min(res[i], v[i]), for i in [0, n).
+      ///
+      /// Like the other batched kernels, branch free, so that
+      /// compilers can vectorize it.
+      template <typename OutIt, typename InIt>
+      static void
+      add_n(OutIt res, InIt v, size_t n)
+      {
+        for (size_t i = 0; i < n; ++i)
+          res[i] = std::min(res[i], v[i]);
+      }
+
+      /// res[i] = res[i] + v[i], unless one of them is zero, for i in
+      /// [0, n).
+      template <typename OutIt, typename InIt>
+      static void
+      mul_n(OutIt res, InIt v, size_t n)
+      {
+        const auto z = zero();
+        for (size_t i = 0; i < n; ++i)
+          res[i] = (res[i] == z) | (v[i] == z) ? z : res[i] + v[i];
+      }
+
+      /// res[i] = min(res[i], a + x[i]), unless x[i] is zero, for i
+      /// in [0, n).
+      template <typename OutIt, typename InIt>
+      static void
+      axpy(OutIt res, const value_t a, InIt x, size_t n)
+      {
+        const auto z = zero();
+        if (a != z)
+          for (size_t i = 0; i < n; ++i)
+            res[i] = std::min(res[i], x[i] == z ? z : a + x[i]);
+      }
+
       value_t
       rdivide(const value_t l, const value_t r) const
       {
@@ -68,6 +68,11 @@ namespace vcsn
       : std::false_type
     {};
 
+    template <>
+    struct is_division_ring<zh>
+      : std::false_type
+    {};
+
     template <typename Context, wet_kind_t Kind>
     struct is_division_ring<polynomialset<Context, Kind>>
       : std::false_type
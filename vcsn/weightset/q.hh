@@ -48,7 +48,7 @@ namespace vcsn
       /// Put it in normal form.
       value_t& reduce()
       {
-        int gc = gcd(abs(num), den);
+        int gc = gcd<unsigned>(abs(num), den);
         num /= gc;
         den /= gc;
         return *this;
@@ -0,0 +1,534 @@
+#pragma once
+
+#include <climits>
+#include <memory> // shared_ptr
+#include <ostream>
+#include <string>
+
+#include <cstddef> // https://gcc.gnu.org/gcc-4.9/porting_to.html
+#include <gmpxx.h>
+
+#include <vcsn/core/join.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/math.hh> // gcd
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/star-status.hh>
+#include <vcsn/misc/stream.hh> // eat
+#include <vcsn/misc/symbol.hh>
+#include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/fwd.hh>
+#include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/weightset.hh>
+#include <vcsn/weightset/z.hh>
+#include <vcsn/weightset/zh.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+  /// Rationals, stored inline while numerator and denominator fit in
+  /// a long, and promoted to GMP when an operation overflows.
+  class qh_impl
+  {
+  public:
+    using self_t = qh;
+
+    static symbol sname()
+    {
+      static auto res = symbol{"qh"};
+      return res;
+    }
+
+    /// Build from the description in \a is.
+    static qh make(std::istream& is)
+    {
+      eat(is, sname());
+      return {};
+    }
+
+    /// A rational of any size.
+    ///
+    /// Rationals whose reduced numerator and denominator are in
+    /// [-LONG_MAX, LONG_MAX] are always stored inline, the others in
+    /// a shared, immutable, mpq_class.  Hence each rational has a
+    /// single representation.
+    class value_t
+    {
+    public:
+      value_t(long n = 0)
+        : num_{n}
+      {
+        if (n == LONG_MIN)
+          big_ = std::make_shared<const mpq_class>(n);
+      }
+
+      value_t(const zh_impl::value_t& n)
+      {
+        if (n.fits_slong_p())
+          num_ = n.get_si();
+        else
+          big_ = std::make_shared<const mpq_class>(n.get_mpz());
+      }
+
+      /// \pre v is canonical.
+      explicit value_t(const mpq_class& v)
+      {
+        const auto& n = v.get_num();
+        const auto& d = v.get_den();
+        if (n.fits_slong_p() && n != LONG_MIN && d.fits_slong_p())
+          {
+            num_ = n.get_si();
+            den_ = d.get_si();
+          }
+        else
+          big_ = std::make_shared<const mpq_class>(v);
+      }
+
+      /// The reduced fraction \a n / \a d.
+      ///
+      /// \pre  0 < d, and n and d are in [-LONG_MAX, LONG_MAX].
+      static value_t reduced(long n, long d)
+      {
+        auto g = gcd(std::labs(n), d);
+        return {n / g, d / g};
+      }
+
+      /// Whether stored inline.
+      bool fits_slong_p() const
+      {
+        return !big_;
+      }
+
+      /// The numerator.
+      zh_impl::value_t get_num() const
+      {
+        if (fits_slong_p())
+          return num_;
+        else
+          return zh_impl::value_t{big_->get_num()};
+      }
+
+      /// The denominator.
+      zh_impl::value_t get_den() const
+      {
+        if (fits_slong_p())
+          return den_;
+        else
+          return zh_impl::value_t{big_->get_den()};
+      }
+
+      /// The value as a GMP rational.
+      mpq_class get_mpq() const
+      {
+        if (big_)
+          return *big_;
+        else
+          return mpq_class{mpz_class{num_}, mpz_class{den_}};
+      }
+
+      /// Three-way comparison.
+      friend int cmp(const value_t& l, const value_t& r)
+      {
+        long ln, rn;
+        if (l.fits_slong_p() && r.fits_slong_p()
+            && !__builtin_mul_overflow(l.num_, r.den_, &ln)
+            && !__builtin_mul_overflow(r.num_, l.den_, &rn))
+          return (rn < ln) - (ln < rn);
+        else
+          return ::cmp(l.get_mpq(), r.get_mpq());
+      }
+
+      friend bool operator==(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() || r.fits_slong_p())
+          return (!l.big_ && !r.big_
+                  && l.num_ == r.num_ && l.den_ == r.den_);
+        else
+          return *l.big_ == *r.big_;
+      }
+
+      friend bool operator<(const value_t& l, const value_t& r)
+      {
+        return cmp(l, r) < 0;
+      }
+
+      friend value_t operator-(const value_t& v)
+      {
+        if (v.fits_slong_p())
+          return value_t{-v.num_, v.den_};
+        else
+          return value_t{mpq_class{-*v.big_}};
+      }
+
+      /// The inverse.
+      /// \pre v is not zero.
+      friend value_t inverse(const value_t& v)
+      {
+        if (v.fits_slong_p())
+          return (0 < v.num_
+                  ? value_t{v.den_, v.num_}
+                  : value_t{-v.den_, -v.num_});
+        else
+          return value_t{mpq_class{1 / *v.big_}};
+      }
+
+      friend value_t operator+(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p())
+          {
+            // l.num/l.den + r.num/r.den
+            //   = (l.num * (r.den/g) + r.num * (l.den/g)) / (l.den * r.den/g)
+            auto g = gcd(l.den_, r.den_);
+            long ln, rn, n, d;
+            if (!__builtin_mul_overflow(l.num_, r.den_ / g, &ln)
+                && !__builtin_mul_overflow(r.num_, l.den_ / g, &rn)
+                && !__builtin_add_overflow(ln, rn, &n)
+                && !__builtin_mul_overflow(l.den_, r.den_ / g, &d)
+                && n != LONG_MIN)
+              return reduced(n, d);
+          }
+        return value_t{mpq_class{l.get_mpq() + r.get_mpq()}};
+      }
+
+      friend value_t operator-(const value_t& l, const value_t& r)
+      {
+        return l + -r;
+      }
+
+      friend value_t operator*(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p())
+          {
+            if (!l.num_ || !r.num_)
+              return 0;
+            // Cross-reduce first: the result is then reduced.
+            auto g1 = gcd(std::labs(l.num_), r.den_);
+            auto g2 = gcd(std::labs(r.num_), l.den_);
+            long n, d;
+            if (!__builtin_mul_overflow(l.num_ / g1, r.num_ / g2, &n)
+                && !__builtin_mul_overflow(l.den_ / g2, r.den_ / g1, &d)
+                && n != LONG_MIN)
+              return value_t{n, d};
+          }
+        return value_t{mpq_class{l.get_mpq() * r.get_mpq()}};
+      }
+
+      friend size_t hash_value(const value_t& v)
+      {
+        size_t res = 0;
+        if (v.fits_slong_p())
+          {
+            hash_combine(res, vcsn::hash_value(v.num_));
+            hash_combine(res, vcsn::hash_value(v.den_));
+          }
+        else
+          hash_combine(res, vcsn::hash_value(v.big_->get_str()));
+        return res;
+      }
+
+      friend std::ostream& operator<<(std::ostream& o, const value_t& v)
+      {
+        if (v.fits_slong_p())
+          {
+            o << v.num_;
+            if (v.den_ != 1)
+              o << '/' << v.den_;
+            return o;
+          }
+        else
+          return o << *v.big_;
+      }
+
+    private:
+      /// A reduced fraction.
+      value_t(long n, long d)
+        : num_{n}
+        , den_{d}
+      {}
+
+      long num_ = 0;
+      long den_ = 1;
+      /// If non null, the value, which does not fit in num_/den_.
+      std::shared_ptr<const mpq_class> big_;
+    };
+
+    /// Create rational weight from num and den.
+    value_t value(const zh_impl::value_t& num,
+                  const zh_impl::value_t& den) const
+    {
+      require(!zh_impl::is_zero(den), *this, ": null denominator");
+      if (num.fits_slong_p() && den.fits_slong_p())
+        return value_t::reduced(0 < den ? num.get_si() : -num.get_si(),
+                                std::labs(den.get_si()));
+      else
+        {
+          auto q = mpq_class{num.get_mpz(), den.get_mpz()};
+          q.canonicalize();
+          return value_t{q};
+        }
+    }
+
+    static value_t zero()
+    {
+      return 0;
+    }
+
+    static value_t one()
+    {
+      return 1;
+    }
+
+    static value_t min()
+    {
+      return -LONG_MAX;
+    }
+
+    static value_t max()
+    {
+      return LONG_MAX;
+    }
+
+    static value_t add(const value_t& l, const value_t& r)
+    {
+      return l + r;
+    }
+
+    static value_t sub(const value_t& l, const value_t& r)
+    {
+      return l - r;
+    }
+
+    static value_t mul(const value_t& l, const value_t& r)
+    {
+      return l * r;
+    }
+
+    /// GCD: arbitrarily the first argument.
+    value_t
+    lgcd(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(l), *this, ": lgcd: invalid lhs: zero");
+      require(!is_zero(r), *this, ": lgcd: invalid rhs: zero");
+      return l;
+    }
+
+    value_t
+    rgcd(const value_t& l, const value_t& r) const
+    {
+      return lgcd(l, r);
+    }
+
+    value_t
+    rdivide(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(r), *this, ": div: division by zero");
+      return l * inverse(r);
+    }
+
+    value_t
+    ldivide(const value_t& l, const value_t& r) const
+    {
+      return rdivide(r, l);
+    }
+
+    value_t star(const value_t& v) const
+    {
+      auto num = v.get_num();
+      auto den = v.get_den();
+      if (num < den && -num < den)
+        return value(den, den - num);
+      else
+        raise_not_starrable(*this, v);
+    }
+
+    static bool is_special(const value_t&) // C++11: cannot be constexpr.
+    {
+      return false;
+    }
+
+    static bool is_zero(const value_t& v)
+    {
+      return v == zero();
+    }
+
+    static bool is_one(const value_t& v)
+    {
+      // All values are normalized.
+      return v == one();
+    }
+
+    /// Three-way comparison between \a l and \a r.
+    static int compare(const value_t& l, const value_t& r)
+    {
+      return cmp(l, r);
+    }
+
+    /// Whether \a l == \a r.
+    static bool equal(const value_t& l, const value_t& r)
+    {
+      return l == r;
+    }
+
+    /// Whether \a l < \a r.
+    static bool less(const value_t& l, const value_t& r)
+    {
+      return l < r;
+    }
+
+    static constexpr bool is_commutative() { return true; }
+    static constexpr bool has_lightening_weights() { return true; }
+
+    static constexpr bool show_one() { return false; }
+    static constexpr star_status_t star_status() { return star_status_t::ABSVAL; }
+
+    static value_t
+    abs(const value_t& v)
+    {
+      return v < zero() ? -v : v;
+    }
+
+    static value_t
+    transpose(const value_t& v)
+    {
+      return v;
+    }
+
+    static size_t hash(const value_t& v)
+    {
+      return hash_value(v);
+    }
+
+    static value_t
+    conv(self_t, const value_t& v)
+    {
+      return v;
+    }
+
+    value_t
+    conv(q, const q::value_t& v) const
+    {
+      return value(v.num, v.den);
+    }
+
+    static value_t
+    conv(zh, const zh::value_t& v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(z, const z::value_t v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(b, const b::value_t v)
+    {
+      return long(v);
+    }
+
+    value_t
+    conv(std::istream& i, bool = true) const
+    {
+      auto num = zh::value_t{};
+      if (!zh_impl::read(i, num))
+        raise(*this, ": invalid numerator: ", i);
+
+      // If we have a slash after the numerator then we have a
+      // denominator as well.
+      if (i.peek() == '/')
+        {
+          eat(i, '/');
+          auto den = zh::value_t{};
+          if (!zh_impl::read(i, den))
+            raise(*this, ": invalid denominator: ", i);
+          return value(num, den);
+        }
+      else
+        return num;
+    }
+
+    static std::ostream&
+    print(const value_t& v, std::ostream& o = std::cout,
+          format fmt = {})
+    {
+      if (fmt == format::latex)
+        {
+          auto den = v.get_den();
+          if (zh_impl::is_one(den))
+            o << v.get_num();
+          else
+            o << "\\frac{" << v.get_num() << "}{" << den << '}';
+        }
+      else
+        o << v;
+      return o;
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          o << "\\mathbb{Q}_{\\text{h}}";
+          break;
+        case format::sname:
+          o << sname();
+          break;
+        case format::text:
+          o << "Qh";
+          break;
+        case format::utf8:
+          o << "ℚh";
+          break;
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+  };
+
+    /// Random generation.
+    template <typename RandomGenerator>
+    class random_weight<qh, RandomGenerator>
+      : public random_weight_base<qh, RandomGenerator>
+    {
+    public:
+      using super_t = random_weight_base<qh, RandomGenerator>;
+      using value_t = typename super_t::weight_t;
+
+      using super_t::super_t;
+
+    private:
+      value_t pick_value_() const
+      {
+        auto min = super_t::min_.get_num();
+        auto max = super_t::max_.get_num();
+        require(min.fits_slong_p() && max.fits_slong_p() && 0 < max,
+                "random_weight: qh: invalid bounds");
+        auto dis_num
+          = std::uniform_int_distribution<long>(min.get_si(), max.get_si());
+        auto dis_den
+          = std::uniform_int_distribution<long>(1, max.get_si());
+        auto num = dis_num(super_t::gen_);
+        auto den = dis_den(super_t::gen_);
+        return super_t::ws_.value(num, den);
+      }
+    };
+
+
+    /*-------.
+    | join.  |
+    `-------*/
+
+    VCSN_JOIN_SIMPLE(b, qh);
+    VCSN_JOIN_SIMPLE(z, qh);
+    VCSN_JOIN_SIMPLE(q, qh);
+    VCSN_JOIN_SIMPLE(zh, qh);
+    VCSN_JOIN_SIMPLE(qh, qh);
+  }
+}
@@ -43,6 +43,40 @@ namespace vcsn
     /// Whether T features a power member function.
     template <typename T>
     using has_power_mem_fn = detail::detect<T, power_mem_fn_t>;
+
+    /// The signature of add_n.
+    template <typename T>
+    using add_n_mem_fn_t
+      = decltype(std::declval<T>()
+                 .add_n(std::declval<typename T::value_t*>(),
+                        std::declval<const typename T::value_t*>(), 0));
+
+    /// Whether T features an add_n member function.
+    template <typename T>
+    using has_add_n_mem_fn = detail::detect<T, add_n_mem_fn_t>;
+
+    /// The signature of mul_n.
+    template <typename T>
+    using mul_n_mem_fn_t
+      = decltype(std::declval<T>()
+                 .mul_n(std::declval<typename T::value_t*>(),
+                        std::declval<const typename T::value_t*>(), 0));
+
+    /// Whether T features a mul_n member function.
+    template <typename T>
+    using has_mul_n_mem_fn = detail::detect<T, mul_n_mem_fn_t>;
+
+    /// The signature of axpy.
+    template <typename T>
+    using axpy_mem_fn_t
+      = decltype(std::declval<T>()
+                 .axpy(std::declval<typename T::value_t*>(),
+                       std::declval<typename T::value_t>(),
+                       std::declval<const typename T::value_t*>(), 0));
+
+    /// Whether T features an axpy member function.
+    template <typename T>
+    using has_axpy_mem_fn = detail::detect<T, axpy_mem_fn_t>;
   }
 
   /// Provide a variadic mul on top of a binary mul(), and one().
@@ -102,6 +136,84 @@ namespace vcsn
     {
       return power_<WeightSet>(e, n);
     }
+
+    /*------------------.
+    | Batched kernels.  |
+    `------------------*/
+
+    // Algorithms working on rows of weights should prefer these to
+    // loops on add and mul: weightsets may provide implementations
+    // that compilers can vectorize, or that avoid useless work (e.g.,
+    // adding zero).  Iterators must be random access.
+
+  private:
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto add_n_(OutIt res, InIt v, size_t n) const
+      -> std::enable_if_t<detail::has_add_n_mem_fn<WS>{}>
+    {
+      super_t::add_n(res, v, n);
+    }
+
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto add_n_(OutIt res, InIt v, size_t n) const
+      -> std::enable_if_t<!detail::has_add_n_mem_fn<WS>{}>
+    {
+      for (size_t i = 0; i < n; ++i)
+        res[i] = super_t::add(res[i], v[i]);
+    }
+
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto mul_n_(OutIt res, InIt v, size_t n) const
+      -> std::enable_if_t<detail::has_mul_n_mem_fn<WS>{}>
+    {
+      super_t::mul_n(res, v, n);
+    }
+
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto mul_n_(OutIt res, InIt v, size_t n) const
+      -> std::enable_if_t<!detail::has_mul_n_mem_fn<WS>{}>
+    {
+      for (size_t i = 0; i < n; ++i)
+        res[i] = super_t::mul(res[i], v[i]);
+    }
+
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto axpy_(OutIt res, const value_t& a, InIt x, size_t n) const
+      -> std::enable_if_t<detail::has_axpy_mem_fn<WS>{}>
+    {
+      super_t::axpy(res, a, x, n);
+    }
+
+    template <typename WS = super_t, typename OutIt, typename InIt>
+    auto axpy_(OutIt res, const value_t& a, InIt x, size_t n) const
+      -> std::enable_if_t<!detail::has_axpy_mem_fn<WS>{}>
+    {
+      if (!super_t::is_zero(a))
+        for (size_t i = 0; i < n; ++i)
+          res[i] = super_t::add(res[i], super_t::mul(a, x[i]));
+    }
+
+  public:
+    /// res[i] = res[i] + v[i], for i in [0, n).
+    template <typename OutIt, typename InIt>
+    void add_n(OutIt res, InIt v, size_t n) const
+    {
+      add_n_<WeightSet>(res, v, n);
+    }
+
+    /// res[i] = res[i] * v[i], for i in [0, n).
+    template <typename OutIt, typename InIt>
+    void mul_n(OutIt res, InIt v, size_t n) const
+    {
+      mul_n_<WeightSet>(res, v, n);
+    }
+
+    /// res[i] = res[i] + a * x[i], for i in [0, n).
+    template <typename OutIt, typename InIt>
+    void axpy(OutIt res, const value_t& a, InIt x, size_t n) const
+    {
+      axpy_<WeightSet>(res, a, x, n);
+    }
   };
 
 
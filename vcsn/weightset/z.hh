@@ -85,7 +85,7 @@ namespace vcsn
     {
       require(!is_zero(l), *this, ": lgcd: invalid lhs: zero");
       require(!is_zero(r), *this, ": lgcd: invalid rhs: zero");
-      return detail::gcd(l, r);
+      return detail::gcd<unsigned>(l, r);
     }
 
     value_t
@@ -0,0 +1,465 @@
+#pragma once
+
+#include <cctype> // isdigit
+#include <climits>
+#include <memory> // shared_ptr
+#include <ostream>
+#include <string>
+
+#include <cstddef> // https://gcc.gnu.org/gcc-4.9/porting_to.html
+#include <gmpxx.h>
+
+#include <vcsn/core/join.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/functional.hh> // hash_value
+#include <vcsn/misc/math.hh> // gcd
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/star-status.hh>
+#include <vcsn/misc/stream.hh>
+#include <vcsn/misc/symbol.hh>
+#include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/fwd.hh>
+#include <vcsn/weightset/weightset.hh>
+#include <vcsn/weightset/z.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+  /// Integers, stored inline while they fit in a long, and promoted
+  /// to GMP when an operation overflows.
+  class zh_impl
+  {
+  public:
+    using self_t = zh;
+
+    static symbol sname()
+    {
+      static auto res = symbol{"zh"};
+      return res;
+    }
+
+    /// Build from the description in \a is.
+    static zh make(std::istream& is)
+    {
+      eat(is, sname());
+      return {};
+    }
+
+    /// An integer of any size.
+    ///
+    /// Values in [-LONG_MAX, LONG_MAX] are always stored inline, the
+    /// others in a shared, immutable, mpz_class.  Hence each integer
+    /// has a single representation, and negating an inline value
+    /// never overflows.
+    class value_t
+    {
+    public:
+      value_t(long v = 0)
+        : small_{v}
+      {
+        if (v == LONG_MIN)
+          big_ = std::make_shared<const mpz_class>(v);
+      }
+
+      explicit value_t(const mpz_class& v)
+      {
+        if (v.fits_slong_p() && v != LONG_MIN)
+          small_ = v.get_si();
+        else
+          big_ = std::make_shared<const mpz_class>(v);
+      }
+
+      /// Whether stored inline.
+      bool fits_slong_p() const
+      {
+        return !big_;
+      }
+
+      /// The inline value.
+      /// \pre fits_slong_p().
+      long get_si() const
+      {
+        assert(fits_slong_p());
+        return small_;
+      }
+
+      /// The value as a GMP integer.
+      mpz_class get_mpz() const
+      {
+        return big_ ? *big_ : mpz_class(small_);
+      }
+
+      /// Three-way comparison.
+      friend int cmp(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p())
+          return (r.small_ < l.small_) - (l.small_ < r.small_);
+        else
+          return ::cmp(l.get_mpz(), r.get_mpz());
+      }
+
+      friend bool operator==(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() || r.fits_slong_p())
+          return !l.big_ && !r.big_ && l.small_ == r.small_;
+        else
+          return *l.big_ == *r.big_;
+      }
+
+#define DEFINE(Op)                                                      \
+      friend bool operator Op(const value_t& l, const value_t& r)       \
+      {                                                                 \
+        return cmp(l, r) Op 0;                                          \
+      }
+      DEFINE(!=) DEFINE(<) DEFINE(<=) DEFINE(>) DEFINE(>=)
+#undef DEFINE
+
+      friend value_t operator-(const value_t& v)
+      {
+        if (v.fits_slong_p())
+          return -v.small_;
+        else
+          return value_t{mpz_class{-*v.big_}};
+      }
+
+      friend value_t abs(const value_t& v)
+      {
+        return v < 0 ? -v : v;
+      }
+
+      /// Define operator Op, using \a Builtin on inline values, and
+      /// GMP if it overflows.
+#define DEFINE(Op, Builtin)                                             \
+      friend value_t operator Op(const value_t& l, const value_t& r)    \
+      {                                                                 \
+        long res;                                                       \
+        if (l.fits_slong_p() && r.fits_slong_p()                        \
+            && !Builtin(l.small_, r.small_, &res))                      \
+          return res;                                                   \
+        else                                                            \
+          return value_t{mpz_class{l.get_mpz() Op r.get_mpz()}};        \
+      }                                                                 \
+                                                                        \
+      value_t& operator Op##=(const value_t& r)                         \
+      {                                                                 \
+        return *this = *this Op r;                                      \
+      }
+      DEFINE(+, __builtin_add_overflow)
+      DEFINE(-, __builtin_sub_overflow)
+      DEFINE(*, __builtin_mul_overflow)
+#undef DEFINE
+
+      /// Truncated division, as for ints.  Cannot overflow on inline
+      /// values, since LONG_MIN is not one of them.
+      friend value_t operator/(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p())
+          return l.small_ / r.small_;
+        else
+          return value_t{mpz_class{l.get_mpz() / r.get_mpz()}};
+      }
+
+      value_t& operator/=(const value_t& r)
+      {
+        return *this = *this / r;
+      }
+
+      /// Remainder of the truncated division, as for ints.
+      friend value_t operator%(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p())
+          return l.small_ % r.small_;
+        else
+          return value_t{mpz_class{l.get_mpz() % r.get_mpz()}};
+      }
+
+      value_t& operator%=(const value_t& r)
+      {
+        return *this = *this % r;
+      }
+
+      /// Greatest common divisor.
+      friend value_t gcd(const value_t& l, const value_t& r)
+      {
+        if (l.fits_slong_p() && r.fits_slong_p() && r.small_)
+          return detail::gcd(std::labs(l.small_), std::labs(r.small_));
+        else
+          {
+            auto res = mpz_class{};
+            mpz_gcd(res.get_mpz_t(),
+                    l.get_mpz().get_mpz_t(), r.get_mpz().get_mpz_t());
+            return value_t{res};
+          }
+      }
+
+      friend size_t hash_value(const value_t& v)
+      {
+        if (v.fits_slong_p())
+          return vcsn::hash_value(v.small_);
+        else
+          return vcsn::hash_value(v.big_->get_str());
+      }
+
+      friend std::ostream& operator<<(std::ostream& o, const value_t& v)
+      {
+        if (v.fits_slong_p())
+          return o << v.small_;
+        else
+          return o << *v.big_;
+      }
+
+    private:
+      long small_ = 0;
+      /// If non null, the value, which does not fit in small_.
+      std::shared_ptr<const mpz_class> big_;
+    };
+
+    static value_t
+    zero()
+    {
+      return 0;
+    }
+
+    static value_t
+    one()
+    {
+      return 1;
+    }
+
+    static value_t
+    min()
+    {
+      return -LONG_MAX;
+    }
+
+    static value_t
+    max()
+    {
+      return LONG_MAX;
+    }
+
+    static value_t
+    add(const value_t& l, const value_t& r)
+    {
+      return l + r;
+    }
+
+    static value_t
+    sub(const value_t& l, const value_t& r)
+    {
+      return l - r;
+    }
+
+    static value_t
+    mul(const value_t& l, const value_t& r)
+    {
+      return l * r;
+    }
+
+    value_t
+    lgcd(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(l), *this, ": lgcd: invalid lhs: zero");
+      require(!is_zero(r), *this, ": lgcd: invalid rhs: zero");
+      return gcd(l, r);
+    }
+
+    value_t
+    rgcd(const value_t& l, const value_t& r) const
+    {
+      return lgcd(l, r);
+    }
+
+    value_t
+    rdivide(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(r), *this, ": div: division by zero");
+      require(is_zero(l % r),
+              *this, ": div: invalid division: ", l, '/', r);
+      return l / r;
+    }
+
+    value_t
+    ldivide(const value_t& l, const value_t& r) const
+    {
+      return rdivide(r, l);
+    }
+
+    value_t
+    star(const value_t& v) const
+    {
+      if (is_zero(v))
+        return one();
+      else
+        raise_not_starrable(*this, v);
+    }
+
+    constexpr static bool is_special(const value_t&)
+    {
+      return false;
+    }
+
+    static bool
+    is_zero(const value_t& v)
+    {
+      return v.fits_slong_p() && v.get_si() == 0;
+    }
+
+    static bool
+    is_one(const value_t& v)
+    {
+      return v.fits_slong_p() && v.get_si() == 1;
+    }
+
+    /// Three-way comparison between \a l and \a r.
+    static int compare(const value_t& l, const value_t& r)
+    {
+      return cmp(l, r);
+    }
+
+    /// Whether \a l == \a r.
+    static bool
+    equal(const value_t& l, const value_t& r)
+    {
+      return l == r;
+    }
+
+    /// Whether \a lhs < \a rhs.
+    static bool less(const value_t& lhs, const value_t& rhs)
+    {
+      return lhs < rhs;
+    }
+
+    static constexpr bool is_commutative() { return true; }
+    static constexpr bool is_idempotent() { return false; }
+    static constexpr bool has_lightening_weights() { return true; }
+
+    static constexpr bool show_one() { return false; }
+    static constexpr star_status_t star_status() { return star_status_t::NON_STARRABLE; }
+
+    static value_t
+    transpose(const value_t& v)
+    {
+      return v;
+    }
+
+    static size_t hash(const value_t& v)
+    {
+      return hash_value(v);
+    }
+
+    static value_t
+    conv(self_t, const value_t& v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(z, z::value_t v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(b, b::value_t v)
+    {
+      return long(v);
+    }
+
+    /// Read an integer of any size from \a is into \a res.
+    ///
+    /// \returns false if there is no such integer.
+    static bool
+    read(std::istream& is, value_t& res)
+    {
+      auto s = std::string{};
+      is >> std::ws;
+      if (is.peek() == '-' || is.peek() == '+')
+        s += char(is.get());
+      while (isdigit(is.peek()))
+        s += char(is.get());
+      if (s.empty() || !isdigit(s.back()))
+        return false;
+      // LONG_MAX has 19 digits.
+      if (s.size() < 19)
+        res = std::stol(s);
+      else
+        res = value_t{mpz_class{s[0] == '+' ? s.substr(1) : s}};
+      return true;
+    }
+
+    value_t
+    conv(std::istream& is, bool = true) const
+    {
+      value_t res;
+      if (read(is, res))
+        return res;
+      else
+        raise_invalid_value(*this, is);
+    }
+
+    static std::ostream&
+    print(const value_t& v, std::ostream& o = std::cout,
+          format = {})
+    {
+      return o << v;
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          o << "\\mathbb{Z}_{\\text{h}}";
+          break;
+        case format::sname:
+          o << sname();
+          break;
+        case format::text:
+          o << "Zh";
+          break;
+        case format::utf8:
+          o << "ℤh";
+          break;
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+  };
+
+    /// Random generation.
+    template <typename RandomGenerator>
+    class random_weight<zh, RandomGenerator>
+      : public random_weight_base<zh, RandomGenerator>
+    {
+    public:
+      using super_t = random_weight_base<zh, RandomGenerator>;
+      using value_t = typename super_t::weight_t;
+
+      using super_t::super_t;
+
+    private:
+      value_t pick_value_() const override
+      {
+        require(super_t::min_.fits_slong_p() && super_t::max_.fits_slong_p(),
+                "random_weight: zh: bounds are too large");
+        auto dis
+          = std::uniform_int_distribution<long>(super_t::min_.get_si(),
+                                                super_t::max_.get_si());
+        return dis(super_t::gen_);
+      }
+    };
+
+    /*-------.
+    | join.  |
+    `-------*/
+
+    VCSN_JOIN_SIMPLE(b, zh);
+    VCSN_JOIN_SIMPLE(z, zh);
+    VCSN_JOIN_SIMPLE(zh, zh);
+  }
+}